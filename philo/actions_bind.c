@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   actions_bind.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:31:12 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 07:31:12 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name print_none
+ * @brief The log action for --log=none: the line is dropped
+ *
+ * @param philo Unused
+ * @param state Unused
+ */
+static void	print_none(t_philo *philo, t_state state)
+{
+	(void)philo;
+	(void)state;
+}
+
+/**
+ * @name print_shared
+ * @brief The print action with --shm: publish, then log
+ *
+ * @param philo Philosopher whose state changed
+ * @param state New state
+ */
+static void	print_shared(t_philo *philo, t_state state)
+{
+	shm_publish(philo, state);
+	philo->data->act.log(philo, state);
+}
+
+/**
+ * @name bind_take
+ * @brief Picks the take action, engine first, then lock
+ *
+ * @param data Pointer to main data structure
+ *
+ * --lock-stats keeps fork_lock_take, which counts around whichever
+ * lock --fork-lock chose; otherwise that lock is bound directly.
+ */
+static void	bind_take(t_data *data)
+{
+	if (data->engine_mode == ENGINE_CORO)
+		data->act.take = coro_fork_take;
+	else if (data->lock_stats)
+		data->act.take = fork_lock_take;
+	else if (data->lock_mode == LOCK_SPIN)
+		data->act.take = spin_take;
+	else if (data->lock_mode == LOCK_FIFO)
+		data->act.take = fifo_take;
+	else
+		data->act.take = mutex_take;
+}
+
+/**
+ * @name bind_drop
+ * @brief Picks the drop action, engine first, then forks, then lock
+ *
+ * @param data Pointer to main data structure
+ */
+static void	bind_drop(t_data *data)
+{
+	if (data->engine_mode == ENGINE_CORO)
+		data->act.drop = coro_fork_drop;
+	else if (data->fork_mode == FORKS_HYGIENIC)
+		data->act.drop = hygienic_drop;
+	else if (data->lock_mode == LOCK_SPIN)
+		data->act.drop = spin_drop;
+	else if (data->lock_mode == LOCK_FIFO)
+		data->act.drop = fifo_drop;
+	else
+		data->act.drop = mutex_drop;
+}
+
+/**
+ * @name bind_actions
+ * @brief Resolves every per-run option into the philosophers' actions
+ *
+ * @param data Pointer to main data structure, fully set up
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ acquire  hygienic_acquire | ordered_acquire     │
+ * │ take     coro | counted | spin | fifo | mutex   │
+ * │ drop     coro | hygienic | spin | fifo | mutex  │
+ * │ log      print_status | log_status | nothing    │
+ * │ print    log, after shm_publish with --shm      │
+ * │ think    think_fixed | think_adaptive           │
+ * │                                                 │
+ * │ Called once before any thread starts; the meal  │
+ * │ loop then makes indirect calls and no tests     │
+ * └─────────────────────────────────────────────────┘
+ */
+void	bind_actions(t_data *data)
+{
+	data->act.acquire = ordered_acquire;
+	if (data->fork_mode == FORKS_HYGIENIC)
+		data->act.acquire = hygienic_acquire;
+	bind_take(data);
+	bind_drop(data);
+	data->act.log = print_status;
+	if (data->log_mode == LOG_ASYNC)
+		data->act.log = log_status;
+	else if (data->log_mode == LOG_NONE)
+		data->act.log = print_none;
+	data->act.print = data->act.log;
+	if (data->shm)
+		data->act.print = print_shared;
+	data->act.think = think_adaptive;
+	if (data->think_mode == THINK_FIXED)
+		data->act.think = think_fixed;
+}
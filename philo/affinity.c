@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   affinity.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:11:40 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 08:47:13 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name list_cpus
+ * @brief Lists the CPUs philosophers may be placed on
+ *
+ * @param data Pointer to main data structure
+ * @param set CPUs the process is allowed to run on
+ * @return int SUCCESS if the list was allocated, FAILURE otherwise
+ *
+ * The monitor CPU is left out, so the monitors have it to themselves,
+ * unless it is the only CPU there is.
+ */
+static int	list_cpus(t_data *data, cpu_set_t *set)
+{
+	int	cpu;
+	int	total;
+
+	total = CPU_COUNT(set);
+	data->cpus = malloc(sizeof(int) * total);
+	if (!data->cpus)
+		return (FAILURE);
+	cpu = 0;
+	while (cpu < CPU_SETSIZE)
+	{
+		if (CPU_ISSET(cpu, set) && (cpu != data->monitor_cpu || total == 1))
+		{
+			data->cpus[data->cpu_count] = cpu;
+			data->cpu_count++;
+		}
+		cpu++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @name init_affinity
+ * @brief Checks the placement options against the CPUs we may use
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if placement is off or possible, FAILURE otherwise
+ *
+ * Starts from the process affinity, so taskset and cpusets are obeyed:
+ * "--pin=rr" under "taskset -c 4-7" spreads over CPUs 4 to 7 only.
+ */
+int	init_affinity(t_data *data)
+{
+	cpu_set_t	set;
+
+	if (data->pin_mode == PIN_NONE && data->monitor_cpu < 0)
+		return (SUCCESS);
+	if (data->pin_mode != PIN_NONE && data->engine_mode != ENGINE_THREADS)
+		return (dprintf(data->out_fd, "Error: --pin needs --engine=threads\n"),
+			FAILURE);
+	if (sched_getaffinity(0, sizeof(set), &set) != 0)
+		return (dprintf(data->out_fd, "Error: Cannot read CPU affinity\n"),
+			FAILURE);
+	if (data->monitor_cpu >= 0 && !CPU_ISSET(data->monitor_cpu, &set))
+		return (dprintf(data->out_fd,
+				"Error: Monitor CPU %d is not available\n", data->monitor_cpu),
+			FAILURE);
+	return (list_cpus(data, &set));
+}
+
+/**
+ * @name pin_philosopher
+ * @brief Restricts a philosopher thread to its CPU
+ *
+ * @param data Pointer to main data structure
+ * @param philo Philosopher whose thread was just created
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ N = 8 on CPUs {0, 1, 2, 3}                      │
+ * │                                                 │
+ * │ rr:     1→0 2→1 3→2 4→3 5→0 6→1 7→2 8→3         │
+ * │ packed: 1→0 2→0 3→1 4→1 5→2 6→2 7→3 8→3         │
+ * │         neighbours share a CPU, and the fork    │
+ * │         between them stays in its cache         │
+ * │ none:   any CPU but the monitor's               │
+ * └─────────────────────────────────────────────────┘
+ *
+ * Placement is best effort: a refused request leaves the thread where
+ * the kernel put it.
+ */
+void	pin_philosopher(t_data *data, t_philo *philo)
+{
+	cpu_set_t	set;
+	long		i;
+
+	if (!data->cpus)
+		return ;
+	CPU_ZERO(&set);
+	i = philo->id - 1;
+	if (data->pin_mode == PIN_RR)
+		CPU_SET(data->cpus[i % data->cpu_count], &set);
+	else if (data->pin_mode == PIN_PACKED)
+		CPU_SET(data->cpus[i * data->cpu_count / data->num_philosophers],
+			&set);
+	i = 0;
+	while (data->pin_mode == PIN_NONE && i < data->cpu_count)
+	{
+		CPU_SET(data->cpus[i], &set);
+		i++;
+	}
+	pthread_setaffinity_np(philo->thread, sizeof(set), &set);
+}
+
+/**
+ * @name tune_monitor
+ * @brief Applies --monitor-cpu and --monitor-sched to a monitor thread
+ *
+ * @param data Pointer to main data structure
+ * @param thread Monitor thread, still waiting on the start gate
+ *
+ * SCHED_FIFO at the lowest real-time priority is enough to preempt
+ * every philosopher. Without CAP_SYS_NICE (or an RLIMIT_RTPRIO) the
+ * kernel refuses it: we say so once on stderr, keep the default policy
+ * and run anyway.
+ */
+void	tune_monitor(t_data *data, pthread_t thread)
+{
+	cpu_set_t			set;
+	struct sched_param	param;
+
+	if (data->monitor_cpu >= 0)
+	{
+		CPU_ZERO(&set);
+		CPU_SET(data->monitor_cpu, &set);
+		pthread_setaffinity_np(thread, sizeof(set), &set);
+	}
+	if (!data->monitor_fifo)
+		return ;
+	memset(&param, 0, sizeof(param));
+	param.sched_priority = sched_get_priority_min(SCHED_FIFO);
+	if (pthread_setschedparam(thread, SCHED_FIFO, &param) == 0)
+		return ;
+	data->monitor_fifo = 0;
+	fprintf(stderr, "Warning: SCHED_FIFO refused, monitors keep the "
+		"default policy\n");
+}
@@ -0,0 +1,168 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:41:20 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 06:55:12 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name arena_size
+ * @brief Adds up every per-run array before any of them exists
+ *
+ * @param data Pointer to main data structure, options parsed
+ * @return size_t Bytes the arena needs, each array on its own lines
+ *
+ * Must list every arena_alloc made during init: forks, philosophers,
+ * log suffixes, the meal table, the latency block, the monitor shards
+ * with their deadline heaps, the --metrics slack buffer, the coroutine
+ * or DES engine arrays and, with --log=async, the event rings.
+ */
+static size_t	arena_size(t_data *data)
+{
+	size_t	n;
+	size_t	size;
+	size_t	shards;
+
+	n = data->num_philosophers;
+	size = line_round(sizeof(t_fork) * n) + line_round(sizeof(t_philo) * n)
+		+ line_round(LOG_SUFFIX_SIZE * ST_COUNT * n)
+		+ line_round(line_round(sizeof(atomic_llong) * n)
+			+ 2 * line_round(sizeof(atomic_int) * n))
+		+ line_round(sizeof(t_latency));
+	shards = shard_count(data);
+	if (data->engine_mode != ENGINE_DES)
+		size += line_round(sizeof(t_shard) * shards)
+			+ line_round(sizeof(t_deadline) * n) + CACHE_LINE * shards;
+	if (data->log_mode == LOG_ASYNC)
+		size += line_round(sizeof(t_ring) * (n + 1)) + LOG_BUF_SIZE
+			+ line_round(sizeof(t_event) * LOG_RING_SIZE * (n + 1));
+	if (data->metrics.interval_ms > 0)
+		size += line_round(sizeof(long long) * n);
+	return (size + engine_arena_size(data));
+}
+
+/**
+ * @name arena_map
+ * @brief Maps the arena with ordinary pages, or transparent huge ones
+ *
+ * @param arena Arena to fill in
+ * @param size Usable size, a whole number of huge pages when thp is set
+ * @param thp Whether to ask for transparent huge pages
+ * @return int SUCCESS if the mapping exists, FAILURE otherwise
+ *
+ * The kernel only backs 2 MB-aligned ranges with a huge page, so for THP
+ * one extra huge page is mapped and the arena starts at the first
+ * boundary inside it.
+ */
+static int	arena_map(t_arena *arena, size_t size, int thp)
+{
+	char	*map;
+
+	arena->map_size = size + thp * HUGE_PAGE;
+	map = mmap(NULL, arena->map_size, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (map == MAP_FAILED)
+		return (FAILURE);
+	arena->map = map;
+	arena->next = map;
+	if (thp)
+	{
+		arena->next = (char *)(((uintptr_t)map + HUGE_PAGE - 1)
+				& ~(uintptr_t)(HUGE_PAGE - 1));
+		madvise(arena->next, size, MADV_HUGEPAGE);
+	}
+	arena->end = arena->next + size;
+	return (SUCCESS);
+}
+
+/**
+ * @name arena_init
+ * @brief Maps one block big enough for all per-run state
+ *
+ * @param data Pointer to main data structure, options parsed
+ * @return int SUCCESS if the arena is mapped, FAILURE otherwise
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ --huge=off  4 KB pages (default)                │
+ * │ --huge=thp  2 MB aligned, madvise(HUGEPAGE)     │
+ * │ --huge=on   MAP_HUGETLB from the reserved pool; │
+ * │             thp with a warning if it is empty   │
+ * │                                                 │
+ * │ [forks][philos][suffixes][meal table][latency]  │
+ * │ [shards][heaps...][rings][writer buf][slots]    │
+ * │  each array on its own cache lines, all zeroed  │
+ * └─────────────────────────────────────────────────┘
+ */
+int	arena_init(t_data *data)
+{
+	size_t	size;
+	char	*map;
+
+	size = arena_size(data);
+	if (data->huge_mode != HUGE_OFF)
+		size = (size + HUGE_PAGE - 1) / HUGE_PAGE * HUGE_PAGE;
+	if (data->huge_mode != HUGE_ON)
+		return (arena_map(&data->arena, size, data->huge_mode == HUGE_THP));
+	map = mmap(NULL, size, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+	if (map == MAP_FAILED)
+	{
+		fprintf(stderr, "Warning: no huge pages reserved, using THP\n");
+		return (arena_map(&data->arena, size, 1));
+	}
+	data->arena.map = map;
+	data->arena.map_size = size;
+	data->arena.next = map;
+	data->arena.end = map + size;
+	return (SUCCESS);
+}
+
+/**
+ * @name arena_alloc
+ * @brief Carves a zeroed, cache-line aligned array out of the arena
+ *
+ * @param data Pointer to main data structure
+ * @param size Size in bytes
+ * @return void* The array, or NULL if arena_size did not plan for it
+ *
+ * Arrays of t_fork and t_philo need the alignment: their elements are
+ * padded to CACHE_LINE, which only keeps neighbours apart if element 0
+ * is aligned. Nothing is freed on its own; arena_free drops it all.
+ */
+void	*arena_alloc(t_data *data, size_t size)
+{
+	char	*block;
+
+	size = line_round(size);
+	if (!data->arena.next
+		|| size > (size_t)(data->arena.end - data->arena.next))
+		return (NULL);
+	block = data->arena.next;
+	data->arena.next += size;
+	return (block);
+}
+
+/**
+ * @name arena_free
+ * @brief Releases every array carved from the arena with one munmap
+ *
+ * @param data Pointer to main data structure
+ */
+void	arena_free(t_data *data)
+{
+	if (data->arena.map)
+		munmap(data->arena.map, data->arena.map_size);
+	memset(&data->arena, 0, sizeof(t_arena));
+	data->forks = NULL;
+	data->philosophers = NULL;
+	data->shards = NULL;
+	data->latency = NULL;
+}
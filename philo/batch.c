@@ -0,0 +1,173 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:19:20 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 04:19:20 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name parse_batch_args
+ * @brief Reads the options that follow --batch=FILE
+ *
+ * @param batch Batch to configure
+ * @param argc Argument count from main
+ * @param argv Argument values from main; argv[1] is --batch=FILE
+ * @return int SUCCESS if every option was valid, FAILURE otherwise
+ *
+ * --jobs=N asks for N runners (default: one per core, never more);
+ * --out=DIR is where scenario_<line>.log files go (default: .).
+ */
+static int	parse_batch_args(t_batch *batch, int argc, char **argv)
+{
+	char	*value;
+	int		i;
+
+	batch->out_dir = ".";
+	i = 2;
+	while (i < argc)
+	{
+		value = option_value(argv[i], "--jobs");
+		if (value)
+			batch->runners = ft_atoi(value);
+		if (value && batch->runners <= 0)
+			return (printf("Error: Invalid job count %s\n", value), FAILURE);
+		if (option_value(argv[i], "--out"))
+			batch->out_dir = option_value(argv[i], "--out");
+		else if (!value)
+			return (printf("Error: Unknown batch argument %s\n", argv[i]),
+				FAILURE);
+		i++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @name runner_count
+ * @brief Caps the runners at the core count and at the scenario count
+ *
+ * @param batch Batch with its scenarios loaded
+ * @return int Number of runner threads to start
+ */
+static int	runner_count(t_batch *batch)
+{
+	long	cores;
+	int		count;
+
+	cores = sysconf(_SC_NPROCESSORS_ONLN);
+	if (cores < 1)
+		cores = 1;
+	count = batch->runners;
+	if (count <= 0 || count > cores)
+		count = cores;
+	if (count > batch->count)
+		count = batch->count;
+	return (count);
+}
+
+/**
+ * @name batch_runner
+ * @brief Runner thread: takes the next scenario until none are left
+ *
+ * @param arg The shared t_batch
+ * @return void* Always NULL
+ */
+static void	*batch_runner(void *arg)
+{
+	t_batch	*batch;
+	int		i;
+
+	batch = arg;
+	i = atomic_fetch_add(&batch->next, 1);
+	while (i < batch->count)
+	{
+		batch_run_job(batch, &batch->jobs[i]);
+		i = atomic_fetch_add(&batch->next, 1);
+	}
+	return (NULL);
+}
+
+/**
+ * @name run_batch
+ * @brief Starts the runners and waits for all of them
+ *
+ * @param batch Batch with its scenarios loaded
+ * @return int SUCCESS if at least one runner started, FAILURE otherwise
+ *
+ * Jobs are claimed, not assigned, so a runner that fails to start only
+ * leaves more work to the others.
+ */
+static int	run_batch(t_batch *batch)
+{
+	pthread_t	*threads;
+	int			started;
+	int			i;
+
+	batch->runners = runner_count(batch);
+	threads = malloc(sizeof(pthread_t) * batch->runners);
+	if (!threads)
+		return (FAILURE);
+	started = 0;
+	while (started < batch->runners
+		&& pthread_create(&threads[started], NULL, batch_runner, batch) == 0)
+		started++;
+	i = 0;
+	while (i < started)
+	{
+		pthread_join(threads[i], NULL);
+		i++;
+	}
+	free(threads);
+	batch->runners = started;
+	if (started == 0)
+		return (FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @name batch_main
+ * @brief Runs every scenario of a --batch file in this one process
+ *
+ * @param argc Argument count from main
+ * @param argv Argument values from main; argv[1] is --batch=FILE
+ * @return int 0 if every scenario ran, 1 otherwise
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ ./philo --batch=sweep.txt --jobs=4 --out=logs   │
+ * │                                                 │
+ * │ runner 1: line 2 ─────┐ line 6 ──┐ ...          │
+ * │ runner 2: line 3 ──┐ line 5 ───┐ ...            │
+ * │ ...                                             │
+ * │                                                 │
+ * │ Each scenario gets a t_data of its own and logs │
+ * │ to logs/scenario_<line>.log; at most one runner │
+ * │ per core. The summary table goes to stdout once │
+ * │ the last runner is joined                       │
+ * └─────────────────────────────────────────────────┘
+ */
+int	batch_main(int argc, char **argv)
+{
+	t_batch		batch;
+	long long	start;
+	int			status;
+
+	memset(&batch, 0, sizeof(t_batch));
+	status = parse_batch_args(&batch, argc, argv);
+	if (status == SUCCESS)
+		status = batch_load(&batch, option_value(argv[1], "--batch"));
+	start = get_time();
+	if (status == SUCCESS)
+		status = run_batch(&batch);
+	if (status == SUCCESS)
+		status = batch_summary(&batch, get_time() - start);
+	free(batch.text);
+	free(batch.jobs);
+	return (status);
+}
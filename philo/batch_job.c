@@ -0,0 +1,191 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch_job.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:16:45 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 08:47:13 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name split_words
+ * @brief Cuts a scenario line into an argv, in place
+ *
+ * @param words Writable copy of the line
+ * @param argv Room for BATCH_ARGS + 2 pointers
+ * @param number Line of the batch file, for the error message
+ * @return int argc, "philo" included, or -1 if the line has too many
+ *             words
+ */
+static int	split_words(char *words, char **argv, int number)
+{
+	int	argc;
+
+	argv[0] = "philo";
+	argc = 1;
+	while (*words)
+	{
+		while (*words == ' ' || *words == '\t' || *words == '\r')
+		{
+			*words = '\0';
+			words++;
+		}
+		if (!*words)
+			break ;
+		if (argc > BATCH_ARGS)
+			return (printf("Error: line %d: more than %d words\n", number,
+					BATCH_ARGS), -1);
+		argv[argc] = words;
+		argc++;
+		while (*words && *words != ' ' && *words != '\t' && *words != '\r')
+			words++;
+	}
+	argv[argc] = NULL;
+	return (argc);
+}
+
+/**
+ * @name open_output
+ * @brief Creates the file a scenario writes its log to
+ *
+ * @param batch Batch holding the output directory
+ * @param job Scenario, named after its line in the batch file
+ * @return int Open descriptor, or -1 if the file cannot be created
+ */
+static int	open_output(t_batch *batch, t_job *job)
+{
+	char	path[BATCH_PATH_SIZE];
+	int		len;
+	int		fd;
+
+	len = snprintf(path, BATCH_PATH_SIZE, "%s/scenario_%d.log",
+			batch->out_dir, job->number);
+	fd = -1;
+	if (len > 0 && len < BATCH_PATH_SIZE)
+		fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		printf("Error: Cannot create the output of line %d\n", job->number);
+	return (fd);
+}
+
+/**
+ * @name batch_run_job
+ * @brief Runs one scenario to the end on the calling runner thread
+ *
+ * @param batch Batch the job belongs to
+ * @param job Scenario to run; its outcome is filled in
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ line "5 800 200 200 7 --engine=des"             │
+ * │   → argv {philo, 5, 800, 200, 200, 7, ...}      │
+ * │   → fresh t_data, out_fd = DIR/scenario_N.log   │
+ * │   → run_simulation, exactly as main would       │
+ * │                                                 │
+ * │ The scenario's own errors land in its log, not  │
+ * │ on the stdout the runners share                 │
+ * │                                                 │
+ * │ --engine=coro defaults to one worker per        │
+ * │ scenario: the runners already fill the cores    │
+ * └─────────────────────────────────────────────────┘
+ */
+void	batch_run_job(t_batch *batch, t_job *job)
+{
+	t_data		data;
+	char		*argv[BATCH_ARGS + 2];
+	char		*words;
+	int			argc;
+	long long	start;
+
+	memset(&data, 0, sizeof(t_data));
+	job->status = FAILURE;
+	words = strdup(job->line);
+	argc = 0;
+	if (words)
+		argc = split_words(words, argv, job->number);
+	if (argc > 0)
+		data.out_fd = open_output(batch, job);
+	if (argc > 0 && data.out_fd >= 0)
+	{
+		data.worker_count = 1;
+		start = get_time();
+		job->status = run_simulation(&data, argc, argv);
+		job->wall_ms = get_time() - start;
+		job->died = data.died;
+		job->must_eat = data.must_eat_count;
+		close(data.out_fd);
+	}
+	free(words);
+}
+
+/**
+ * @name print_job
+ * @brief Prints one row of the summary table
+ *
+ * @param job Finished scenario
+ */
+static void	print_job(t_job *job)
+{
+	char	*outcome;
+
+	outcome = "stopped";
+	if (job->status == FAILURE)
+		outcome = "error";
+	else if (job->died)
+		outcome = "died";
+	else if (job->must_eat > 0)
+		outcome = "fed";
+	if (job->died)
+		printf("%6d  %-7s %5d %9lld  %s\n", job->number, outcome,
+			job->died, job->wall_ms, job->line);
+	else
+		printf("%6d  %-7s %5s %9lld  %s\n", job->number, outcome,
+			"-", job->wall_ms, job->line);
+}
+
+/**
+ * @name batch_summary
+ * @brief Prints the outcome of every scenario, in file order
+ *
+ * @param batch Batch whose runners have all been joined
+ * @param wall_ms Wall time of the whole batch
+ * @return int SUCCESS if every scenario ran, FAILURE if any failed
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │   line  outcome  died   wall_ms  scenario       │
+ * │      2  fed         -      3012  5 800 200 200 7│
+ * │      4  died      117       412  200 410 200 200│
+ * │ 2 scenarios on 2 runners in 3013 ms: 1 died,    │
+ * │ 0 failed                                        │
+ * └─────────────────────────────────────────────────┘
+ */
+int	batch_summary(t_batch *batch, long long wall_ms)
+{
+	int	i;
+	int	died;
+	int	failed;
+
+	printf("%6s  %-7s %5s %9s  %s\n", "line", "outcome", "died", "wall_ms",
+		"scenario");
+	i = 0;
+	died = 0;
+	failed = 0;
+	while (i < batch->count)
+	{
+		print_job(&batch->jobs[i]);
+		died += batch->jobs[i].died != 0;
+		failed += batch->jobs[i].status == FAILURE;
+		i++;
+	}
+	printf("%d scenarios on %d runners in %lld ms: %d died, %d failed\n",
+		batch->count, batch->runners, wall_ms, died, failed);
+	if (failed)
+		return (FAILURE);
+	return (SUCCESS);
+}
@@ -0,0 +1,168 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch_load.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:14:02 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 04:14:02 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name read_all
+ * @brief Reads exactly size bytes, or up to end of file
+ *
+ * @param fd Open file
+ * @param buf Destination, at least size bytes
+ * @param size Bytes wanted
+ * @return ssize_t Bytes read, -1 on a read error
+ */
+static ssize_t	read_all(int fd, char *buf, size_t size)
+{
+	size_t	got;
+	ssize_t	done;
+
+	got = 0;
+	while (got < size)
+	{
+		done = read(fd, buf + got, size - got);
+		if (done < 0)
+			return (-1);
+		if (done == 0)
+			break ;
+		got += done;
+	}
+	return (got);
+}
+
+/**
+ * @name read_file
+ * @brief Reads a whole scenario file into one NUL-terminated buffer
+ *
+ * @param path File to read
+ * @param size Set to the number of bytes read
+ * @return char* The buffer, or NULL if the file cannot be read
+ */
+static char	*read_file(char *path, size_t *size)
+{
+	struct stat	st;
+	char		*text;
+	ssize_t		done;
+	int			fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (printf("Error: Cannot open %s\n", path), NULL);
+	text = NULL;
+	done = -1;
+	if (fstat(fd, &st) == 0)
+		text = malloc(st.st_size + 1);
+	if (text)
+		done = read_all(fd, text, st.st_size);
+	close(fd);
+	if (done < 0)
+	{
+		free(text);
+		return (printf("Error: Cannot read %s\n", path), NULL);
+	}
+	text[done] = '\0';
+	*size = done;
+	return (text);
+}
+
+/**
+ * @name is_blank
+ * @brief Tells whether a scenario line holds no scenario
+ *
+ * @param line Line without its newline
+ * @return int 1 for an empty, all-blank or "#" comment line, 0 otherwise
+ */
+static int	is_blank(char *line)
+{
+	while (*line == ' ' || *line == '\t' || *line == '\r')
+		line++;
+	return (*line == '\0' || *line == '#');
+}
+
+/**
+ * @name fill_jobs
+ * @brief Cuts the text into lines and keeps one job per scenario line
+ *
+ * @param batch Batch whose text is loaded and jobs allocated
+ * @param size Length of the text
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ 1 # sweep of time_to_die                        │
+ * │ 2 5 800 200 200 7                               │
+ * │ 3                                               │
+ * │ 4 200 410 200 200 --engine=des --until=5000     │
+ * │                                                 │
+ * │ → jobs {line 2, line 4}; the numbers name the   │
+ * │   output files scenario_2.log and scenario_4.log│
+ * └─────────────────────────────────────────────────┘
+ */
+static void	fill_jobs(t_batch *batch, size_t size)
+{
+	char	*line;
+	char	*nl;
+	int		number;
+
+	line = batch->text;
+	number = 1;
+	while (line < batch->text + size)
+	{
+		nl = memchr(line, '\n', batch->text + size - line);
+		if (nl)
+			*nl = '\0';
+		if (!is_blank(line))
+		{
+			batch->jobs[batch->count].line = line;
+			batch->jobs[batch->count].number = number;
+			batch->count++;
+		}
+		if (!nl)
+			break ;
+		line = nl + 1;
+		number++;
+	}
+}
+
+/**
+ * @name batch_load
+ * @brief Loads a --batch file and lists its scenarios
+ *
+ * @param batch Batch to fill; text and jobs are its to free
+ * @param path Scenario file, one philo argument set per line
+ * @return int SUCCESS if at least one scenario was found, FAILURE
+ *             otherwise
+ */
+int	batch_load(t_batch *batch, char *path)
+{
+	size_t	size;
+	size_t	lines;
+	size_t	i;
+
+	batch->text = read_file(path, &size);
+	if (!batch->text)
+		return (FAILURE);
+	lines = 1;
+	i = 0;
+	while (i < size)
+	{
+		if (batch->text[i] == '\n')
+			lines++;
+		i++;
+	}
+	batch->jobs = calloc(lines, sizeof(t_job));
+	if (!batch->jobs)
+		return (FAILURE);
+	fill_jobs(batch, size);
+	if (batch->count == 0)
+		return (printf("Error: No scenario in %s\n", path), FAILURE);
+	return (SUCCESS);
+}
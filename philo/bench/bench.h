@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:55:02 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/18 21:41:52 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_H
+# define BENCH_H
+
+# include <poll.h>
+# include <signal.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <sys/resource.h>
+# include <sys/time.h>
+# include <sys/wait.h>
+# include <time.h>
+# include <unistd.h>
+
+/* Longest philo output line the parser keeps whole */
+# define BENCH_LINE 128
+/* Cap for runs that end on their own (deaths, must_eat), in ms */
+# define BENCH_TIMEOUT_MS 20000
+/* Compare mode: relative drop in meals/s that counts as a regression */
+# define BENCH_MEALS_TOL 0.10
+/* Compare mode: relative growth in CPU time that counts as a regression */
+# define BENCH_CPU_TOL 0.25
+/* Compare mode: extra death latency that counts as a regression, in ms */
+# define BENCH_LATENCY_TOL 3
+/* Compare mode: extra time to the first output line that counts, in ms */
+# define BENCH_FIRST_LOG_TOL 20
+
+typedef enum e_bench_status
+{
+	BENCH_OK,
+	BENCH_FAIL
+}	t_bench_status;
+
+/*
+** One row of the matrix. must is -1 when no must_eat argument is given;
+** duration_ms is 0 for runs that end on their own; hog starts one busy
+** process per core for the length of the run.
+*/
+typedef struct s_config
+{
+	char		*name;
+	int			n;
+	int			die;
+	int			eat;
+	int			sleep;
+	int			must;
+	char		*extra;
+	int			duration_ms;
+	int			hog;
+}				t_config;
+
+/*
+** What the run printed, parsed as it streams in. last_eat holds the
+** latest "is eating" stamp of each philosopher, to measure how late the
+** death line came. spawn_ms and first_ms are when philo was forked and
+** when its first output arrived (0 if it printed nothing).
+*/
+typedef struct s_stream
+{
+	long long	meals;
+	long long	lines;
+	long long	death_ts;
+	int			death_id;
+	long long	*last_eat;
+	int			n;
+	char		part[BENCH_LINE];
+	int			len;
+	long long	spawn_ms;
+	long long	first_ms;
+}				t_stream;
+
+typedef struct s_result
+{
+	char		name[64];
+	double		wall_s;
+	long long	meals;
+	double		meals_per_s;
+	int			died;
+	long long	latency_ms;
+	long long	first_log_ms;
+	double		cpu_s;
+	long		ctxsw;
+	long		max_rss_kb;
+}				t_result;
+
+/* Matrix */
+int				bench_count(void);
+const t_config	*bench_config(int i);
+void			bench_argv(const t_config *cfg, char *path, char **argv,
+					char buf[5][16]);
+
+/* Running */
+int				bench_run(const t_config *cfg, char *path, t_result *res);
+void			stream_feed(t_stream *st, char *buf, int len);
+long long		stream_latency(t_stream *st, const t_config *cfg);
+int				hogs_start(pid_t *pids, int max);
+void			hogs_stop(pid_t *pids, int count);
+
+/* Result files */
+void			csv_header(FILE *out);
+void			csv_row(FILE *out, const t_config *cfg, t_result *res);
+int				csv_load(char *path, t_result *rows, int max);
+int				bench_compare(char *base, char *cur);
+
+#endif
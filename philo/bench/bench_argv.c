@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_argv.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:36:05 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/18 22:36:05 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @name bench_argv
+ * @brief Builds the philo command line for a row
+ *
+ * @param cfg Row to run
+ * @param path Path of the philo binary
+ * @param argv Output, room for 10 entries, NULL-terminated
+ * @param buf Storage for the numeric arguments
+ *
+ * extra is copied and split on spaces, so a row may pass several
+ * options ("--engine=des --until=60000"). The copy lives until the next
+ * call, which is after the child has exec'd.
+ */
+void	bench_argv(const t_config *cfg, char *path, char **argv,
+			char buf[5][16])
+{
+	static char	extra[128];
+	char		*tok;
+	int			i;
+
+	snprintf(buf[0], 16, "%d", cfg->n);
+	snprintf(buf[1], 16, "%d", cfg->die);
+	snprintf(buf[2], 16, "%d", cfg->eat);
+	snprintf(buf[3], 16, "%d", cfg->sleep);
+	snprintf(buf[4], 16, "%d", cfg->must);
+	argv[0] = path;
+	i = 1;
+	while (i <= 4 || (i == 5 && cfg->must != -1))
+	{
+		argv[i] = buf[i - 1];
+		i++;
+	}
+	extra[0] = '\0';
+	if (cfg->extra)
+		snprintf(extra, sizeof(extra), "%s", cfg->extra);
+	tok = strtok(extra, " ");
+	while (tok && i < 9)
+	{
+		argv[i] = tok;
+		i++;
+		tok = strtok(NULL, " ");
+	}
+	argv[i] = NULL;
+}
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_compare.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:46:21 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/18 21:41:52 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @name find_row
+ * @brief Looks a row up by name
+ *
+ * @param rows Rows of a result file
+ * @param count Number of rows
+ * @param name Row name
+ * @return t_result* The row, or NULL if the file has no such row
+ */
+static t_result	*find_row(t_result *rows, int count, char *name)
+{
+	int	i;
+
+	i = 0;
+	while (i < count)
+	{
+		if (strcmp(rows[i].name, name) == 0)
+			return (&rows[i]);
+		i++;
+	}
+	return (NULL);
+}
+
+/**
+ * @name flag
+ * @brief Prints one regression
+ *
+ * @param name Row name
+ * @param what Metric that got worse
+ * @param base Baseline value
+ * @param cur Current value
+ * @return int 1, to be summed into the regression count
+ */
+static int	flag(char *name, char *what, double base, double cur)
+{
+	printf("REGRESSION %-28s %-18s %12.3f -> %12.3f\n", name, what, base,
+		cur);
+	return (1);
+}
+
+/**
+ * @name check_row
+ * @brief Compares one row against its baseline
+ *
+ * @param b Baseline row
+ * @param c Current row
+ * @return int Number of regressions found
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ outcome     died / survived differs             │
+ * │ meals/s     dropped by more than 10 %           │
+ * │ cpu         grew by more than 25 % (and 50 ms)  │
+ * │ latency     death came 3 ms later than before   │
+ * │ first log   came 20 ms later than before        │
+ * └─────────────────────────────────────────────────┘
+ */
+static int	check_row(t_result *b, t_result *c)
+{
+	int	found;
+
+	found = 0;
+	if (b->died != c->died)
+		return (flag(c->name, "died", b->died, c->died));
+	if (c->meals_per_s < b->meals_per_s * (1 - BENCH_MEALS_TOL))
+		found += flag(c->name, "meals_per_s", b->meals_per_s,
+				c->meals_per_s);
+	if (c->cpu_s > b->cpu_s * (1 + BENCH_CPU_TOL) && c->cpu_s
+		- b->cpu_s > 0.05)
+		found += flag(c->name, "cpu_s", b->cpu_s, c->cpu_s);
+	if (c->died && c->latency_ms > b->latency_ms + BENCH_LATENCY_TOL)
+		found += flag(c->name, "death_latency_ms", b->latency_ms,
+				c->latency_ms);
+	if (b->first_log_ms >= 0 && c->first_log_ms > b->first_log_ms
+		+ BENCH_FIRST_LOG_TOL)
+		found += flag(c->name, "first_log_ms", b->first_log_ms,
+				c->first_log_ms);
+	return (found);
+}
+
+/**
+ * @name compare_all
+ * @brief Checks every current row against the baseline, in file order
+ *
+ * @param b Baseline rows
+ * @param nb Number of baseline rows
+ * @param c Current rows
+ * @param nc Number of current rows
+ * @return int Number of regressions found
+ *
+ * Rows missing from the baseline are listed and skipped.
+ */
+static int	compare_all(t_result *b, int nb, t_result *c, int nc)
+{
+	t_result	*base;
+	int			found;
+	int			i;
+
+	found = 0;
+	i = 0;
+	while (i < nc)
+	{
+		base = find_row(b, nb, c[i].name);
+		if (!base)
+			printf("new        %s\n", c[i].name);
+		else
+			found += check_row(base, &c[i]);
+		i++;
+	}
+	return (found);
+}
+
+/**
+ * @name bench_compare
+ * @brief Flags regressions of a result file against a baseline
+ *
+ * @param base Baseline result file
+ * @param cur Result file to judge
+ * @return int BENCH_OK if nothing regressed, BENCH_FAIL otherwise
+ */
+int	bench_compare(char *base, char *cur)
+{
+	t_result	b[64];
+	t_result	c[64];
+	int			nb;
+	int			nc;
+	int			found;
+
+	nb = csv_load(base, b, 64);
+	nc = csv_load(cur, c, 64);
+	if (nb < 0 || nc < 0)
+		return (fprintf(stderr, "bench: cannot read results\n"), BENCH_FAIL);
+	found = compare_all(b, nb, c, nc);
+	printf("%d regression(s)\n", found);
+	return (BENCH_FAIL * (found > 0));
+}
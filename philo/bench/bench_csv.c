@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_csv.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:37:55 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 03:31:08 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @name csv_header
+ * @brief Writes the column names of a result file
+ *
+ * @param out Result file
+ */
+void	csv_header(FILE *out)
+{
+	fprintf(out, "name,n,die,eat,sleep,must,extra,duration_ms,hog,"
+		"wall_s,meals,meals_per_s,died,death_latency_ms,cpu_s,ctxsw,"
+		"max_rss_kb,first_log_ms,cpu_us_per_meal\n");
+}
+
+/**
+ * @name csv_row
+ * @brief Writes one measured row
+ *
+ * @param out Result file
+ * @param cfg Row that was run
+ * @param res Its measurements
+ *
+ * death_latency_ms is -1 when nobody died, first_log_ms when nothing was
+ * printed; extra is "-" when empty, so no field is ever blank.
+ * cpu_us_per_meal is derived from cpu_s and meals, 0 without meals.
+ */
+void	csv_row(FILE *out, const t_config *cfg, t_result *res)
+{
+	char	*extra;
+	double	per_meal;
+
+	extra = cfg->extra;
+	if (!extra)
+		extra = "-";
+	per_meal = 0;
+	if (res->meals > 0)
+		per_meal = res->cpu_s * 1e6 / res->meals;
+	fprintf(out, "%s,%d,%d,%d,%d,%d,%s,%d,%d,", cfg->name, cfg->n,
+		cfg->die, cfg->eat, cfg->sleep, cfg->must, extra,
+		cfg->duration_ms, cfg->hog);
+	fprintf(out, "%.3f,%lld,%.1f,%d,%lld,%.3f,%ld,%ld,%lld,%.1f\n",
+		res->wall_s, res->meals, res->meals_per_s, res->died,
+		res->latency_ms, res->cpu_s, res->ctxsw, res->max_rss_kb,
+		res->first_log_ms, per_meal);
+}
+
+/**
+ * @name csv_load
+ * @brief Reads the measurements back from a result file
+ *
+ * @param path Result file written by csv_header and csv_row
+ * @param rows Output rows
+ * @param max Capacity of rows
+ * @return int Number of rows read, or -1 if the file cannot be opened
+ *
+ * Files written before first_log_ms existed still load, with -1 there.
+ */
+int	csv_load(char *path, t_result *rows, int max)
+{
+	FILE	*in;
+	char	line[512];
+	int		count;
+
+	in = fopen(path, "r");
+	if (!in)
+		return (-1);
+	count = 0;
+	while (count < max && fgets(line, sizeof(line), in))
+	{
+		rows[count].first_log_ms = -1;
+		if (sscanf(line, "%63[^,],%*d,%*d,%*d,%*d,%*d,%*[^,],%*d,%*d,"
+				"%lf,%lld,%lf,%d,%lld,%lf,%ld,%ld,%lld", rows[count].name,
+				&rows[count].wall_s, &rows[count].meals,
+				&rows[count].meals_per_s, &rows[count].died,
+				&rows[count].latency_ms, &rows[count].cpu_s,
+				&rows[count].ctxsw, &rows[count].max_rss_kb,
+				&rows[count].first_log_ms) >= 9)
+			count++;
+	}
+	fclose(in);
+	return (count);
+}
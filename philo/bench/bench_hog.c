@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_hog.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:29:40 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/18 18:29:40 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @name hogs_start
+ * @brief Starts one busy-looping process per online core
+ *
+ * @param pids Output, the hog pids
+ * @param max Capacity of pids
+ * @return int Number of hogs started
+ *
+ * The hogs compete with philo for every core, which is where missed
+ * deadlines and preempted monitors show up.
+ */
+int	hogs_start(pid_t *pids, int max)
+{
+	long			cores;
+	int				count;
+	volatile long	spin;
+
+	cores = sysconf(_SC_NPROCESSORS_ONLN);
+	if (cores < 1)
+		cores = 1;
+	count = 0;
+	while (count < cores && count < max)
+	{
+		pids[count] = fork();
+		if (pids[count] == 0)
+		{
+			spin = 0;
+			while (1)
+				spin++;
+		}
+		if (pids[count] < 0)
+			break ;
+		count++;
+	}
+	return (count);
+}
+
+/**
+ * @name hogs_stop
+ * @brief Kills and reaps the hogs
+ *
+ * @param pids Hog pids
+ * @param count Number of hogs
+ */
+void	hogs_stop(pid_t *pids, int count)
+{
+	int	i;
+
+	i = 0;
+	while (i < count)
+	{
+		kill(pids[i], SIGKILL);
+		waitpid(pids[i], NULL, 0);
+		i++;
+	}
+}
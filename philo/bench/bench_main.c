@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_main.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:55:09 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/18 18:55:09 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @name run_one
+ * @brief Runs a row, under load if it asks for it, and reports progress
+ *
+ * @param cfg Row to run
+ * @param path Path of the philo binary
+ * @param res Output row
+ * @return int BENCH_OK, or BENCH_FAIL if philo could not be run
+ */
+static int	run_one(const t_config *cfg, char *path, t_result *res)
+{
+	pid_t	hogs[256];
+	int		nhogs;
+	int		status;
+
+	nhogs = 0;
+	if (cfg->hog)
+		nhogs = hogs_start(hogs, 256);
+	memset(res, 0, sizeof(t_result));
+	status = bench_run(cfg, path, res);
+	hogs_stop(hogs, nhogs);
+	fprintf(stderr, "%-28s %9.1f meals/s  cpu %6.3f s  death %lld ms\n",
+		cfg->name, res->meals_per_s, res->cpu_s, res->latency_ms);
+	return (status);
+}
+
+/**
+ * @name run_matrix
+ * @brief Runs every row of the matrix into a CSV result file
+ *
+ * @param path Path of the philo binary
+ * @param out_path Result file to write
+ * @return int 0 on success, 1 on failure
+ */
+static int	run_matrix(char *path, char *out_path)
+{
+	t_result	res;
+	FILE		*out;
+	int			i;
+
+	out = fopen(out_path, "w");
+	if (!out)
+		return (fprintf(stderr, "bench: cannot write %s\n", out_path), 1);
+	csv_header(out);
+	i = 0;
+	while (i < bench_count())
+	{
+		if (run_one(bench_config(i), path, &res) != BENCH_OK)
+		{
+			fclose(out);
+			return (fprintf(stderr, "bench: cannot run %s\n", path), 1);
+		}
+		csv_row(out, bench_config(i), &res);
+		fflush(out);
+		i++;
+	}
+	fclose(out);
+	return (0);
+}
+
+/**
+ * @name main
+ * @brief Entry point of the benchmark harness
+ *
+ * @param argc Number of command-line arguments
+ * @param argv Array of command-line arguments
+ * @return int 0 on success (no regression), 1 otherwise
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ ./philo_bench ./philo results.csv               │
+ * │     run the matrix, one CSV row per config      │
+ * │                                                 │
+ * │ ./philo_bench --compare base.csv results.csv    │
+ * │     print regressions, exit 1 if there are any  │
+ * └─────────────────────────────────────────────────┘
+ */
+int	main(int argc, char **argv)
+{
+	if (argc == 4 && strcmp(argv[1], "--compare") == 0)
+		return (bench_compare(argv[2], argv[3]) != BENCH_OK);
+	if (argc != 3)
+	{
+		fprintf(stderr, "usage: %s <philo> <out.csv>\n"
+			"       %s --compare <base.csv> <new.csv>\n", argv[0], argv[0]);
+		return (1);
+	}
+	if (access(argv[1], X_OK) != 0)
+		return (fprintf(stderr, "bench: %s is not executable\n", argv[1]), 1);
+	return (run_matrix(argv[1], argv[2]));
+}
@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_matrix.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:02:47 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 05:48:33 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @name bench_table
+ * @brief The benchmark matrix, small tables
+ *
+ * @return const t_config* First row; the table ends with a NULL name
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ name        n  die eat sleep must extra  ms hog │
+ * │ 4_310_...   4  310 200 100   -    -      0  no  │
+ * │             → runs until the death line         │
+ * │ 200_..._hog 200 800 200 200  -    -   3000  yes │
+ * │             → killed after 3 s, cores kept busy │
+ * │ ..._cycle   1 ms eat and sleep, so the CSV's    │
+ * │             cpu_us_per_meal is the loop's cost  │
+ * └─────────────────────────────────────────────────┘
+ */
+static const t_config	*bench_table(void)
+{
+	static const t_config	table[] = {
+	{"5_800_200_200", 5, 800, 200, 200, -1, NULL, 3000, 0},
+	{"5_800_200_200_7", 5, 800, 200, 200, 7, NULL, 0, 0},
+	{"5_800_200_200_hygienic", 5, 800, 200, 200, -1, "--forks=hygienic", 3000,
+		0},
+	{"4_410_200_200", 4, 410, 200, 200, -1, NULL, 3000, 0},
+	{"4_410_200_200_hog", 4, 410, 200, 200, -1, NULL, 3000, 1},
+	{"4_410_200_200_think_fixed", 4, 410, 200, 200, -1, "--think=fixed",
+		3000, 0},
+	{"4_310_200_100", 4, 310, 200, 100, -1, NULL, 0, 0},
+	{"1_800_200_200", 1, 800, 200, 200, -1, NULL, 0, 0},
+	{"2_1000_1_1_1000_cycle", 2, 1000, 1, 1, 1000, NULL, 0, 0},
+	{"2_1000_1_1_1000_cycle_coro", 2, 1000, 1, 1, 1000, "--engine=coro", 0,
+		0},
+	{"64_1000_1_1_100_cycle", 64, 1000, 1, 1, 100, NULL, 0, 0},
+	{"64_1000_1_1_100_cycle_spin", 64, 1000, 1, 1, 100, "--fork-lock=spin",
+		0, 0},
+	{"64_1000_1_1_100_cycle_fifo", 64, 1000, 1, 1, 100, "--fork-lock=fifo",
+		0, 0},
+	{NULL, 0, 0, 0, 0, 0, NULL, 0, 0}};
+
+	return (table);
+}
+
+/**
+ * @name bench_table_scale
+ * @brief The benchmark matrix, hundreds of philosophers and more
+ *
+ * @return const t_config* First row; the table ends with a NULL name
+ *
+ * Includes the placement rows: on a multi-core host, compare
+ * 200_410_200_200 with its _pin_ variants, and 200_800_200_200_hog with
+ * _hog_monitor (monitors alone on CPU 0, under SCHED_FIFO).
+ */
+static const t_config	*bench_table_scale(void)
+{
+	static const t_config	table[] = {
+	{"200_410_200_200", 200, 410, 200, 200, -1, NULL, 3000, 0},
+	{"200_410_200_200_async", 200, 410, 200, 200, -1, "--log=async", 3000,
+		0},
+	{"200_410_200_200_pin_rr", 200, 410, 200, 200, -1, "--pin=rr", 3000, 0},
+	{"200_410_200_200_pin_packed", 200, 410, 200, 200, -1, "--pin=packed",
+		3000, 0},
+	{"200_800_200_200_hog", 200, 800, 200, 200, -1, NULL, 3000, 1},
+	{"200_800_200_200_hog_monitor", 200, 800, 200, 200, -1,
+		"--pin=packed --monitor-cpu=0 --monitor-sched=fifo", 3000, 1},
+	{"200_800_200_200_10", 200, 800, 200, 200, 10, NULL, 0, 0},
+	{"199_610_200_200", 199, 610, 200, 200, -1, NULL, 3000, 0},
+	{"199_610_200_200_think_fixed", 199, 610, 200, 200, -1,
+		"--think=fixed", 3000, 0},
+	{"199_610_200_200_hygienic", 199, 610, 200, 200, -1, "--forks=hygienic",
+		3000, 0},
+	{"2000_2000_200_200_3", 2000, 2000, 200, 200, 3, NULL, 0, 0},
+	{"2000_800_200_200_coro", 2000, 800, 200, 200, -1, "--engine=coro",
+		3000, 0},
+	{"2000_800_200_200_des", 2000, 800, 200, 200, -1,
+		"--engine=des --until=60000", 0, 0},
+	{NULL, 0, 0, 0, 0, 0, NULL, 0, 0}};
+
+	return (table);
+}
+
+/**
+ * @name bench_count
+ * @brief Number of rows in the matrix
+ *
+ * @return int Row count
+ */
+int	bench_count(void)
+{
+	int	i;
+
+	i = 0;
+	while (bench_config(i)->name)
+		i++;
+	return (i);
+}
+
+/**
+ * @name bench_config
+ * @brief Returns one row of the matrix
+ *
+ * @param i Row index, at most bench_count()
+ * @return const t_config* The row; index bench_count() is the NULL-named
+ *                         end marker
+ */
+const t_config	*bench_config(int i)
+{
+	const t_config	*small;
+	int				count;
+
+	small = bench_table();
+	count = 0;
+	while (small[count].name)
+		count++;
+	if (i < count)
+		return (&small[i]);
+	return (&bench_table_scale()[i - count]);
+}
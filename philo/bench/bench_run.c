@@ -0,0 +1,180 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_run.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:21:14 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/18 21:41:52 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @name now_ms
+ * @brief Monotonic clock in milliseconds
+ *
+ * @return long long Current time
+ */
+static long long	now_ms(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000LL + ts.tv_nsec / 1000000);
+}
+
+/**
+ * @name spawn
+ * @brief Starts philo for a row with its stdout on a pipe
+ *
+ * @param cfg Row to run
+ * @param path Path of the philo binary
+ * @param fd Output, read end of the pipe
+ * @return pid_t Child pid, or -1 on failure
+ */
+static pid_t	spawn(const t_config *cfg, char *path, int *fd)
+{
+	char	*argv[10];
+	char	buf[5][16];
+	int		ends[2];
+	pid_t	pid;
+
+	if (pipe(ends) != 0)
+		return (-1);
+	bench_argv(cfg, path, argv, buf);
+	pid = fork();
+	if (pid == 0)
+	{
+		dup2(ends[1], STDOUT_FILENO);
+		close(ends[0]);
+		close(ends[1]);
+		execv(path, argv);
+		_exit(127);
+	}
+	close(ends[1]);
+	*fd = ends[0];
+	if (pid < 0)
+		close(ends[0]);
+	return (pid);
+}
+
+/**
+ * @name collect
+ * @brief Reads the child's output until EOF, killing it at the deadline
+ *
+ * @param pid Child pid
+ * @param fd Read end of its stdout
+ * @param st Stream state fed with the output
+ * @param limit_ms Run length, after which the child gets SIGKILL; 0 for
+ *                 runs that end on their own (capped at BENCH_TIMEOUT_MS)
+ *
+ * Output is drained the whole time, so philo never blocks on a full
+ * pipe and the measured cost is its own.
+ */
+static void	collect(pid_t pid, int fd, t_stream *st, long long limit_ms)
+{
+	struct pollfd	pfd;
+	char			buf[65536];
+	long long		end;
+	long long		left;
+	ssize_t			got;
+
+	if (limit_ms <= 0)
+		limit_ms = BENCH_TIMEOUT_MS;
+	end = now_ms() + limit_ms;
+	pfd.fd = fd;
+	pfd.events = POLLIN;
+	got = 1;
+	while (got > 0)
+	{
+		left = end - now_ms();
+		if (left <= 0 && kill(pid, SIGKILL) == 0)
+			end = now_ms() + BENCH_TIMEOUT_MS;
+		if (left > 0 && poll(&pfd, 1, left) == 0)
+			continue ;
+		got = read(fd, buf, sizeof(buf));
+		if (got > 0 && st->first_ms == 0)
+			st->first_ms = now_ms();
+		if (got > 0)
+			stream_feed(st, buf, got);
+	}
+}
+
+/**
+ * @name fill_result
+ * @brief Turns the stream, wall clock and rusage into a result row
+ *
+ * @param cfg Row that was run
+ * @param st Stream state after the run
+ * @param ru Child's resource usage from wait4
+ * @param res Output row; wall_s must already be set
+ *
+ * first_log_ms is the time to the first output line, fork and exec
+ * included: how long a large table takes to start. -1 if philo printed
+ * nothing.
+ */
+static void	fill_result(const t_config *cfg, t_stream *st, struct rusage *ru,
+		t_result *res)
+{
+	snprintf(res->name, sizeof(res->name), "%s", cfg->name);
+	res->meals = st->meals;
+	res->meals_per_s = 0;
+	if (res->wall_s > 0)
+		res->meals_per_s = st->meals / res->wall_s;
+	res->died = (st->death_id != 0);
+	res->latency_ms = stream_latency(st, cfg);
+	res->first_log_ms = -1;
+	if (st->first_ms)
+		res->first_log_ms = st->first_ms - st->spawn_ms;
+	res->cpu_s = ru->ru_utime.tv_sec + ru->ru_utime.tv_usec / 1e6
+		+ ru->ru_stime.tv_sec + ru->ru_stime.tv_usec / 1e6;
+	res->ctxsw = ru->ru_nvcsw + ru->ru_nivcsw;
+	res->max_rss_kb = ru->ru_maxrss;
+}
+
+/**
+ * @name bench_run
+ * @brief Runs one row of the matrix and measures it
+ *
+ * @param cfg Row to run
+ * @param path Path of the philo binary
+ * @param res Output row
+ * @return int BENCH_OK, or BENCH_FAIL if philo could not be run
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ fork/exec philo → drain its pipe                │
+ * │ → SIGKILL at duration_ms (or BENCH_TIMEOUT_MS)  │
+ * │ → wait4 for CPU, context switches and max RSS   │
+ * └─────────────────────────────────────────────────┘
+ */
+int	bench_run(const t_config *cfg, char *path, t_result *res)
+{
+	t_stream		st;
+	struct rusage	ru;
+	pid_t			pid;
+	int				fd;
+
+	memset(&st, 0, sizeof(st));
+	st.n = cfg->n;
+	st.last_eat = calloc(cfg->n, sizeof(long long));
+	st.spawn_ms = now_ms();
+	pid = -1;
+	if (st.last_eat)
+		pid = spawn(cfg, path, &fd);
+	if (pid > 0)
+	{
+		collect(pid, fd, &st, cfg->duration_ms);
+		close(fd);
+	}
+	if (pid > 0 && wait4(pid, NULL, 0, &ru) == pid)
+	{
+		res->wall_s = (now_ms() - st.spawn_ms) / 1000.0;
+		fill_result(cfg, &st, &ru, res);
+	}
+	free(st.last_eat);
+	return (BENCH_FAIL * (pid <= 0));
+}
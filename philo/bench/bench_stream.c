@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_stream.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:10:31 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/18 18:10:31 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @name stream_line
+ * @brief Accounts for one complete "<ts> <id> <status>" line
+ *
+ * @param st Stream state
+ * @param line NUL-terminated line without its newline
+ */
+static void	stream_line(t_stream *st, char *line)
+{
+	char		*p;
+	long long	ts;
+	int			id;
+
+	st->lines++;
+	ts = strtoll(line, &p, 10);
+	id = (int)strtol(p, &p, 10);
+	if (id < 1 || id > st->n)
+		return ;
+	if (strncmp(p, " is eating", 10) == 0)
+	{
+		st->meals++;
+		st->last_eat[id - 1] = ts;
+	}
+	else if (strncmp(p, " died", 5) == 0 && st->death_id == 0)
+	{
+		st->death_ts = ts;
+		st->death_id = id;
+	}
+}
+
+/**
+ * @name stream_feed
+ * @brief Splits a chunk of philo's stdout into lines
+ *
+ * @param st Stream state; a line cut by the chunk end waits in part
+ * @param buf Bytes just read
+ * @param len Number of bytes
+ */
+void	stream_feed(t_stream *st, char *buf, int len)
+{
+	int	i;
+
+	i = 0;
+	while (i < len)
+	{
+		if (buf[i] == '\n')
+		{
+			st->part[st->len] = '\0';
+			stream_line(st, st->part);
+			st->len = 0;
+		}
+		else if (st->len < BENCH_LINE - 1)
+		{
+			st->part[st->len] = buf[i];
+			st->len++;
+		}
+		i++;
+	}
+}
+
+/**
+ * @name stream_latency
+ * @brief How late the death line came after the real deadline
+ *
+ * @param st Stream state after the run
+ * @param cfg Row that was run
+ * @return long long Milliseconds between last meal + time_to_die and the
+ *                   printed death, or -1 if nobody died
+ *
+ * A philosopher that never ate is measured from the start (0 ms).
+ */
+long long	stream_latency(t_stream *st, const t_config *cfg)
+{
+	if (st->death_id == 0)
+		return (-1);
+	return (st->death_ts - st->last_eat[st->death_id - 1] - cfg->die);
+}
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:32:06 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 06:33:40 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CHECK_H
+# define CHECK_H
+
+# include <fcntl.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+
+/* Bytes per read(2) when the log comes through a pipe */
+# define CHECK_BLOCK 1048576
+/* Violations printed; the rest are only counted */
+# define CHECK_SHOWN 20
+/* Default slack on a death announcement, in ms */
+# define CHECK_TOL_MS 10
+/* How early a death may be announced: a printed "is eating" timestamp
+** can trail the last_meal_time philo's monitor goes by by 1 ms */
+# define CHECK_EARLY_MS 1
+
+/* Same order as philo's t_state */
+typedef enum e_kind
+{
+	K_FORK,
+	K_EAT,
+	K_SLEEP,
+	K_THINK,
+	K_DIED,
+	K_BAD
+}					t_kind;
+
+typedef struct s_entry
+{
+	long long		ts;
+	long long		id;
+	t_kind			kind;
+}					t_entry;
+
+/*
+** What the log has said about one philosopher so far. eat_ts is the
+** last "is eating", 0 (the start) before the first one; eating stays
+** set until "is sleeping".
+*/
+typedef struct s_seat
+{
+	long long		eat_ts;
+	int				meals;
+	char			forks;
+	char			eating;
+}					t_seat;
+
+/*
+** Run parameters as given to philo, must -1 without a must-eat count.
+** line points at the line being checked, NULL once the log has ended.
+*/
+typedef struct s_checker
+{
+	long long		n;
+	long long		die;
+	long long		eat;
+	long long		sleep;
+	long long		must;
+	long long		tol;
+	t_seat			*seats;
+	long long		last_ts;
+	long long		lines;
+	long long		meals;
+	long long		errors;
+	long long		died;
+	long long		died_ts;
+	const char		*line;
+	size_t			line_len;
+}					t_checker;
+
+/* Input */
+size_t				check_buffer(t_checker *chk, const char *buf, size_t len);
+int					check_file(t_checker *chk, const char *path);
+int					check_fd(t_checker *chk, int fd);
+
+/* Lines and rules */
+void				check_line(t_checker *chk, const char *p, const char *end);
+void				check_event(t_checker *chk, t_entry *e);
+void				check_end(t_checker *chk);
+void				check_fail(t_checker *chk, const char *reason);
+
+#endif
@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_end.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:31:15 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 06:31:15 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "check.h"
+
+/**
+ * @name check_starved
+ * @brief Reports every seat the log let go hungry past its deadline
+ *
+ * @param chk Checker state after the last line
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ 4 310 200 100, log ends at 900 without "died"   │
+ * │ philosopher 3 last ate at 400                   │
+ * │ 400 + 310 + tol 10 = 720 < 900 → starved at 710 │
+ * │                                                 │
+ * │ The seat that did die was checked by on_died;   │
+ * │ any other seat overdue at that point was missed │
+ * └─────────────────────────────────────────────────┘
+ */
+static void	check_starved(t_checker *chk)
+{
+	char		reason[96];
+	long long	deadline;
+	long long	i;
+
+	i = 0;
+	while (i < chk->n)
+	{
+		deadline = chk->seats[i].eat_ts + chk->die;
+		if (i + 1 != chk->died && deadline + chk->tol < chk->last_ts)
+		{
+			snprintf(reason, sizeof(reason), "philosopher %lld starved at "
+				"%lld, no death announced", i + 1, deadline);
+			check_fail(chk, reason);
+		}
+		i++;
+	}
+}
+
+/**
+ * @name check_end
+ * @brief Rules that need the whole log: starvation, must-eat completion
+ *
+ * @param chk Checker state after the last line
+ *
+ * Nobody may be left past a deadline when the log ends. Without a
+ * death, a run given a must-eat count only stops once every
+ * philosopher has eaten that often.
+ */
+void	check_end(t_checker *chk)
+{
+	char		reason[96];
+	long long	i;
+
+	chk->line = NULL;
+	check_starved(chk);
+	if (chk->died || chk->must < 0)
+		return ;
+	i = 0;
+	while (i < chk->n)
+	{
+		if (chk->seats[i].meals < chk->must)
+		{
+			snprintf(reason, sizeof(reason), "philosopher %lld ate %d of "
+				"%lld meals", i + 1, chk->seats[i].meals, chk->must);
+			check_fail(chk, reason);
+		}
+		i++;
+	}
+}
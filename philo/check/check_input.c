@@ -0,0 +1,162 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_input.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:38:44 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 01:38:44 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "check.h"
+
+/**
+ * @name check_buffer
+ * @brief Checks every complete line of a buffer
+ *
+ * @param chk Checker state
+ * @param buf Log bytes
+ * @param len Number of bytes
+ * @return size_t Bytes consumed, up to and including the last newline
+ *
+ * memchr finds the line ends a word or a vector at a time; the rest of
+ * the work per line is a couple of compares, so the checker keeps up
+ * with philo printing straight into a pipe.
+ */
+size_t	check_buffer(t_checker *chk, const char *buf, size_t len)
+{
+	const char	*p;
+	const char	*nl;
+
+	p = buf;
+	nl = memchr(p, '\n', len);
+	while (nl)
+	{
+		check_line(chk, p, nl);
+		p = nl + 1;
+		nl = memchr(p, '\n', buf + len - p);
+	}
+	return (p - buf);
+}
+
+/**
+ * @name check_mapped
+ * @brief Checks a regular file through a read-only mapping
+ *
+ * @param chk Checker state
+ * @param fd Open file
+ * @param size File size, above zero
+ * @return int 0 on success, 1 if the file cannot be mapped
+ */
+static int	check_mapped(t_checker *chk, int fd, size_t size)
+{
+	char	*map;
+	size_t	used;
+
+	map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (map == MAP_FAILED)
+		return (1);
+	madvise(map, size, MADV_SEQUENTIAL);
+	used = check_buffer(chk, map, size);
+	if (used < size)
+		check_line(chk, map + used, map + size);
+	munmap(map, size);
+	return (0);
+}
+
+/**
+ * @name keep_tail
+ * @brief Checks the whole lines of the read buffer and keeps the rest
+ *
+ * @param chk Checker state
+ * @param buf Read buffer, CHECK_BLOCK bytes
+ * @param have Bytes in it
+ * @return size_t Bytes of the partial last line, now at the front
+ */
+static size_t	keep_tail(t_checker *chk, char *buf, size_t have)
+{
+	size_t	used;
+
+	used = check_buffer(chk, buf, have);
+	if (used == 0 && have == CHECK_BLOCK)
+	{
+		check_fail(chk, "line too long");
+		used = have;
+	}
+	memmove(buf, buf + used, have - used);
+	return (have - used);
+}
+
+/**
+ * @name check_fd
+ * @brief Checks a log read from a pipe or terminal
+ *
+ * @param chk Checker state
+ * @param fd Descriptor to read until end of file
+ * @return int 0 on success, 1 on a read error
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ buf: [ whole lines ........ | partial line ]    │
+ * │        checked                └─ moved to the   │
+ * │                                  front; the     │
+ * │                                  next read      │
+ * │                                  appends to it  │
+ * └─────────────────────────────────────────────────┘
+ */
+int	check_fd(t_checker *chk, int fd)
+{
+	char	*buf;
+	size_t	have;
+	ssize_t	got;
+
+	buf = malloc(CHECK_BLOCK);
+	if (!buf)
+		return (fprintf(stderr, "philo_check: out of memory\n"), 1);
+	have = 0;
+	got = read(fd, buf, CHECK_BLOCK);
+	while (got > 0)
+	{
+		have = keep_tail(chk, buf, have + got);
+		got = read(fd, buf + have, CHECK_BLOCK - have);
+	}
+	if (have > 0)
+		check_line(chk, buf, buf + have);
+	free(buf);
+	if (got < 0)
+		return (fprintf(stderr, "philo_check: read error\n"), 1);
+	return (0);
+}
+
+/**
+ * @name check_file
+ * @brief Checks a log file, mapping it when it is a regular file
+ *
+ * @param chk Checker state
+ * @param path Log path, "-" for stdin
+ *
+ * A redirected stdin that is a regular file is mapped as well.
+ * @return int 0 on success, 1 on failure
+ */
+int	check_file(t_checker *chk, const char *path)
+{
+	struct stat	st;
+	int			fd;
+	int			status;
+
+	fd = STDIN_FILENO;
+	if (strcmp(path, "-") != 0)
+		fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (fprintf(stderr, "philo_check: cannot open %s\n", path), 1);
+	status = 1;
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+		status = check_mapped(chk, fd, st.st_size);
+	if (status != 0)
+		status = check_fd(chk, fd);
+	if (fd != STDIN_FILENO)
+		close(fd);
+	return (status);
+}
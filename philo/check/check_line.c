@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_line.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:47:15 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 01:47:15 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "check.h"
+
+/**
+ * @name parse_number
+ * @brief Reads a decimal number followed by one space
+ *
+ * @param p Cursor, moved past the space
+ * @param end End of the line
+ * @param out Parsed value
+ * @return int 0 on success, 1 if there is no number or no space
+ */
+static int	parse_number(const char **p, const char *end, long long *out)
+{
+	const char	*s;
+	long long	value;
+
+	s = *p;
+	value = 0;
+	while (s < end && *s >= '0' && *s <= '9' && value < 1000000000000LL)
+	{
+		value = value * 10 + (*s - '0');
+		s++;
+	}
+	if (s == *p || s >= end || *s != ' ')
+		return (1);
+	*out = value;
+	*p = s + 1;
+	return (0);
+}
+
+/**
+ * @name parse_kind
+ * @brief Matches the status text of a line
+ *
+ * @param p First byte of the status
+ * @param len Length up to the newline
+ * @return t_kind The status, K_BAD if the text is not exactly one of
+ *                philo's five messages
+ */
+static t_kind	parse_kind(const char *p, size_t len)
+{
+	static const char	*text[] = {"has taken a fork", "is eating",
+		"is sleeping", "is thinking", "died"};
+	static const size_t	size[] = {16, 9, 11, 11, 4};
+	int					kind;
+
+	kind = K_FORK;
+	while (kind < K_BAD)
+	{
+		if (len == size[kind] && memcmp(p, text[kind], len) == 0)
+			return (kind);
+		kind++;
+	}
+	return (K_BAD);
+}
+
+/**
+ * @name check_line
+ * @brief Parses one log line and applies the rules to it
+ *
+ * @param chk Checker state
+ * @param p First byte of the line
+ * @param end Its newline, or the end of the log
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ "1200 3 is eating\n"                            │
+ * │  ts 1200, id 3, K_EAT → check_event             │
+ * │ "1200 3 is eating "  → malformed line           │
+ * │ "1200 9 is eating"   → no philosopher 9 with 5  │
+ * └─────────────────────────────────────────────────┘
+ */
+void	check_line(t_checker *chk, const char *p, const char *end)
+{
+	t_entry	e;
+
+	chk->line = p;
+	chk->line_len = end - p;
+	chk->lines++;
+	e.kind = K_BAD;
+	if (parse_number(&p, end, &e.ts) == 0
+		&& parse_number(&p, end, &e.id) == 0)
+		e.kind = parse_kind(p, end - p);
+	if (e.kind == K_BAD)
+		check_fail(chk, "malformed line");
+	else if (e.id < 1 || e.id > chk->n)
+		check_fail(chk, "no such philosopher");
+	else
+		check_event(chk, &e);
+}
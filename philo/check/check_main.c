@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_main.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:09:51 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 02:09:51 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "check.h"
+
+/**
+ * @name check_fail
+ * @brief Counts a violation and prints the first CHECK_SHOWN of them
+ *
+ * @param chk Checker state
+ * @param reason What rule the current line breaks
+ */
+void	check_fail(t_checker *chk, const char *reason)
+{
+	chk->errors++;
+	if (chk->errors > CHECK_SHOWN)
+		return ;
+	if (chk->line)
+		printf("line %lld: \"%.*s\": %s\n", chk->lines, (int)chk->line_len,
+			chk->line, reason);
+	else
+		printf("end of log: %s\n", reason);
+}
+
+/**
+ * @name parse_args
+ * @brief Reads the run parameters, the options and the log path
+ *
+ * @param chk Checker to fill
+ * @param argv Command-line words after the program name
+ * @param path Output log path, "-" unless one is given
+ * @return int 0 on success, 1 on a bad or missing argument
+ *
+ * The first four or five numbers are the arguments philo was given;
+ * any other word that is not an option is the log.
+ */
+static int	parse_args(t_checker *chk, char **argv, const char **path)
+{
+	long long	*param[5];
+	int			count;
+
+	param[0] = &chk->n;
+	param[1] = &chk->die;
+	param[2] = &chk->eat;
+	param[3] = &chk->sleep;
+	param[4] = &chk->must;
+	count = 0;
+	while (*argv)
+	{
+		if (strncmp(*argv, "--tol=", 6) == 0)
+			chk->tol = atoll(*argv + 6);
+		else if (count < 5 && **argv >= '0' && **argv <= '9')
+			*param[count++] = atoll(*argv);
+		else if (strncmp(*argv, "--", 2) != 0)
+			*path = *argv;
+		else
+			return (fprintf(stderr, "philo_check: unknown option %s\n",
+					*argv), 1);
+		argv++;
+	}
+	return (count < 4 || chk->n < 1 || chk->tol < 0);
+}
+
+/**
+ * @name report
+ * @brief Prints the verdict
+ *
+ * @param chk Checker after check_end
+ * @return int 0 if the log follows every rule, 1 otherwise
+ */
+static int	report(t_checker *chk)
+{
+	if (chk->errors)
+	{
+		printf("FAIL: %lld violation(s) in %lld lines\n", chk->errors,
+			chk->lines);
+		return (1);
+	}
+	printf("OK: %lld lines, %lld meals, ", chk->lines, chk->meals);
+	if (chk->died)
+		printf("philosopher %lld died at %lld ms\n", chk->died,
+			chk->died_ts);
+	else
+		printf("nobody died\n");
+	return (0);
+}
+
+/**
+ * @name main
+ * @brief Entry point of the log validator
+ *
+ * @param argc Number of command-line arguments
+ * @param argv Array of command-line arguments
+ * @return int 0 if the log is valid, 1 if it breaks a rule or cannot be
+ *             read
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ ./philo 200 800 200 200 7 | \                   │
+ * │     ./philo_check 200 800 200 200 7             │
+ * │ ./philo_check 5 800 200 200 run.log --tol=5     │
+ * │ ./philo_trace run.bin | ./philo_check 5 ...     │
+ * └─────────────────────────────────────────────────┘
+ */
+int	main(int argc, char **argv)
+{
+	t_checker	chk;
+	const char	*path;
+	int			status;
+
+	memset(&chk, 0, sizeof(chk));
+	chk.must = -1;
+	chk.tol = CHECK_TOL_MS;
+	path = "-";
+	if (argc < 2 || parse_args(&chk, argv + 1, &path) != 0)
+		return (fprintf(stderr, "usage: %s number_of_philosophers "
+				"time_to_die time_to_eat time_to_sleep [must_eat] "
+				"[--tol=MS] [log]\n", argv[0]), 1);
+	chk.seats = calloc(chk.n, sizeof(t_seat));
+	if (!chk.seats)
+		return (fprintf(stderr, "philo_check: out of memory\n"), 1);
+	status = check_file(&chk, path);
+	if (status == 0)
+	{
+		check_end(&chk);
+		status = report(&chk);
+	}
+	free(chk.seats);
+	return (status);
+}
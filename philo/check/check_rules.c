@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_rules.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:58:30 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 06:33:40 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "check.h"
+
+/**
+ * @name seat_busy
+ * @brief Whether a philosopher is still eating at a given time
+ *
+ * @param chk Checker state
+ * @param seat Philosopher to test
+ * @param ts Time of the line being checked
+ * @return int 1 if the last meal started less than time_to_eat ago and
+ *             no "is sleeping" has ended it
+ *
+ * philo puts the forks down before printing "is sleeping", so a
+ * neighbour may print "is eating" first; the time bound keeps that
+ * legal hand-over from being reported.
+ */
+static int	seat_busy(t_checker *chk, t_seat *seat, long long ts)
+{
+	return (seat->eating && ts < seat->eat_ts + chk->eat);
+}
+
+/**
+ * @name on_eat
+ * @brief Rules for an "is eating" line
+ *
+ * @param chk Checker state
+ * @param seat Philosopher that eats
+ * @param e The line
+ */
+static void	on_eat(t_checker *chk, t_seat *seat, t_entry *e)
+{
+	t_seat	*left;
+	t_seat	*right;
+
+	if (seat->forks != 2)
+		check_fail(chk, "eating without two forks");
+	if (e->ts > seat->eat_ts + chk->die + chk->tol)
+		check_fail(chk, "ate after starving, no death announced");
+	left = &chk->seats[(e->id + chk->n - 2) % chk->n];
+	right = &chk->seats[e->id % chk->n];
+	if (chk->n > 1 && (seat_busy(chk, left, e->ts)
+			|| seat_busy(chk, right, e->ts)))
+		check_fail(chk, "neighbours eating at the same time");
+	seat->eating = 1;
+	seat->eat_ts = e->ts;
+	seat->meals++;
+	chk->meals++;
+}
+
+/**
+ * @name on_died
+ * @brief Rules for a "died" line
+ *
+ * @param chk Checker state
+ * @param seat Philosopher that died
+ * @param e The line
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ 800 310 200 100: last "is eating" at 0          │
+ * │ deadline 0 + 310 = 310                          │
+ * │ "308 1 died" → died before its deadline         │
+ * │ "309 1 died" → fine: the "is eating" stamp may  │
+ * │                trail last_meal_time by 1 ms     │
+ * │ "315 1 died" → fine                             │
+ * │ "321 1 died" → announced 11 ms late (tol 10)    │
+ * └─────────────────────────────────────────────────┘
+ */
+static void	on_died(t_checker *chk, t_seat *seat, t_entry *e)
+{
+	long long	deadline;
+
+	deadline = seat->eat_ts + chk->die;
+	if (e->ts < deadline - CHECK_EARLY_MS)
+		check_fail(chk, "died before its deadline");
+	else if (e->ts > deadline + chk->tol)
+		check_fail(chk, "death announced late");
+	chk->died = e->id;
+	chk->died_ts = e->ts;
+}
+
+/**
+ * @name check_event
+ * @brief Applies the rules of the subject to one parsed line
+ *
+ * @param chk Checker state
+ * @param e The line
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ any line      timestamps never go back, nothing │
+ * │               after "died"                      │
+ * │ fork          at most two held                  │
+ * │ is eating     two forks held, neighbours not    │
+ * │               eating, not past the deadline     │
+ * │ is sleeping   after a meal; the forks go back   │
+ * │ died          within tol ms of the deadline     │
+ * └─────────────────────────────────────────────────┘
+ */
+void	check_event(t_checker *chk, t_entry *e)
+{
+	t_seat	*seat;
+
+	if (chk->died)
+		check_fail(chk, "line after \"died\"");
+	if (e->ts < chk->last_ts)
+		check_fail(chk, "timestamp goes backwards");
+	chk->last_ts = e->ts;
+	seat = &chk->seats[e->id - 1];
+	if (e->kind == K_FORK && seat->forks == 2)
+		check_fail(chk, "more than two forks");
+	else if (e->kind == K_FORK)
+		seat->forks++;
+	else if (e->kind == K_EAT)
+		on_eat(chk, seat, e);
+	else if (e->kind == K_DIED)
+		on_died(chk, seat, e);
+	else if (e->kind == K_SLEEP)
+	{
+		if (!seat->eating)
+			check_fail(chk, "sleeping without eating");
+		seat->eating = 0;
+		seat->forks = 0;
+	}
+}
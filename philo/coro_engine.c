@@ -0,0 +1,157 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   coro_engine.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:04:21 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 07:08:31 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name coro_entry
+ * @brief First frame of every coroutine stack
+ *
+ * @param hi Upper 32 bits of the t_coro pointer
+ * @param lo Lower 32 bits of the t_coro pointer
+ *
+ * makecontext only passes int arguments, hence the split pointer. The
+ * coroutine never returns: it jumps back to whichever worker ran it last.
+ */
+static void	coro_entry(unsigned int hi, unsigned int lo)
+{
+	t_coro	*co;
+
+	co = (t_coro *)(((uintptr_t)hi << 32) | (uintptr_t)lo);
+	philosopher_routine(co->philo);
+	atomic_fetch_add_explicit(&co->philo->data->engine.finished, 1,
+		memory_order_release);
+	setcontext(&co->worker->sched);
+}
+
+/**
+ * @name init_workers
+ * @brief Carves the workers with their run queues and timer heaps out
+ *        of the arena
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if every allocation succeeded, FAILURE otherwise
+ */
+static int	init_workers(t_data *data)
+{
+	t_worker	*w;
+	int			i;
+
+	data->engine.workers = arena_alloc(data,
+			sizeof(t_worker) * data->engine.count);
+	if (!data->engine.workers)
+		return (FAILURE);
+	i = 0;
+	while (i < data->engine.count)
+	{
+		w = &data->engine.workers[i];
+		w->index = i;
+		w->data = data;
+		w->mutex = (pthread_mutex_t)PTHREAD_MUTEX_INITIALIZER;
+		w->runq = arena_alloc(data, sizeof(t_coro *) * data->num_philosophers);
+		w->timers = arena_alloc(data,
+				sizeof(t_coro *) * data->num_philosophers);
+		if (!w->runq || !w->timers || init_monotonic_cond(&w->cond)
+			== FAILURE)
+			return (FAILURE);
+		i++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @name init_coros
+ * @brief Creates one coroutine per philosopher, spread round-robin
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS always
+ *
+ * Stacks come from one MAP_NORESERVE mapping (see coro_map_stacks), so
+ * untouched stack pages cost no memory; each one starts just above its
+ * guard page.
+ */
+static int	init_coros(t_data *data)
+{
+	t_coro		*co;
+	t_worker	*w;
+	int			i;
+
+	i = 0;
+	while (i < data->num_philosophers)
+	{
+		co = &data->engine.coros[i];
+		w = &data->engine.workers[i % data->engine.count];
+		co->philo = &data->philosophers[i];
+		co->worker = w;
+		data->philosophers[i].coro = co;
+		getcontext(&co->ctx);
+		co->ctx.uc_stack.ss_sp = data->engine.stacks
+			+ (size_t)i * data->engine.stride + data->engine.guard;
+		co->ctx.uc_stack.ss_size = CORO_STACK_SIZE;
+		co->ctx.uc_link = NULL;
+		makecontext(&co->ctx, (void (*)(void))coro_entry, 2,
+			(unsigned int)((uintptr_t)co >> 32), (unsigned int)(uintptr_t)co);
+		w->runq[w->count] = co;
+		w->count++;
+		i++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @name coro_init
+ * @brief Prepares the coroutine engine when --engine=coro is selected
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if ready (or engine is threads), FAILURE otherwise
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ N philosophers, W workers (default: one per     │
+ * │ online CPU, --workers=W to override)            │
+ * │                                                 │
+ * │ coros[N]   contexts, stacks[N × 64 KiB] mapped, │
+ * │            a guard page below each one          │
+ * │ workers[W] run queue + timer heap of N slots    │
+ * │ philosopher i starts on worker i % W            │
+ * └─────────────────────────────────────────────────┘
+ */
+int	coro_init(t_data *data)
+{
+	if (data->engine_mode != ENGINE_CORO)
+		return (SUCCESS);
+	data->engine.count = coro_worker_count(data);
+	data->engine.coros = arena_alloc(data,
+			sizeof(t_coro) * data->num_philosophers);
+	if (!data->engine.coros || coro_map_stacks(data) == FAILURE
+		|| init_workers(data) == FAILURE)
+		return (FAILURE);
+	return (init_coros(data));
+}
+
+/**
+ * @name coro_free
+ * @brief Unmaps the coroutine stacks
+ *
+ * @param data Pointer to main data structure
+ *
+ * Workers, queues and coroutines live in the arena and go with it.
+ */
+void	coro_free(t_data *data)
+{
+	if (data->engine.stacks)
+		munmap(data->engine.stacks, data->engine.stride
+			* data->num_philosophers);
+	data->engine.stacks = NULL;
+	data->engine.workers = NULL;
+	data->engine.coros = NULL;
+}
@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   coro_queue.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:36:40 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 06:24:50 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name runq_push
+ * @brief Makes a coroutine runnable on a worker and wakes that worker
+ *
+ * @param w Worker whose run queue receives the coroutine
+ * @param co Coroutine to resume
+ *
+ * Each coroutine is in at most one queue, so num_philosophers slots
+ * per worker can never overflow.
+ */
+void	runq_push(t_worker *w, t_coro *co)
+{
+	int	cap;
+
+	cap = w->data->num_philosophers;
+	pthread_mutex_lock(&w->mutex);
+	w->runq[(w->head + w->count) % cap] = co;
+	w->count++;
+	pthread_cond_signal(&w->cond);
+	pthread_mutex_unlock(&w->mutex);
+}
+
+/**
+ * @name runq_pop
+ * @brief Takes the oldest runnable coroutine of a worker (FIFO)
+ *
+ * @param w Worker whose queue is popped
+ * @return t_coro* Next coroutine, NULL if the queue is empty
+ */
+t_coro	*runq_pop(t_worker *w)
+{
+	t_coro	*co;
+
+	co = NULL;
+	pthread_mutex_lock(&w->mutex);
+	if (w->count > 0)
+	{
+		co = w->runq[w->head];
+		w->head = (w->head + 1) % w->data->num_philosophers;
+		w->count--;
+	}
+	pthread_mutex_unlock(&w->mutex);
+	return (co);
+}
+
+/**
+ * @name runq_steal
+ * @brief Takes the newest runnable coroutine from another worker
+ *
+ * @param thief Idle worker looking for work
+ * @return t_coro* Stolen coroutine, NULL if every other queue is empty
+ *
+ * Victims are scanned starting after the thief so that idle workers do
+ * not all pile on worker 0.
+ */
+t_coro	*runq_steal(t_worker *thief)
+{
+	t_engine	*engine;
+	t_worker	*victim;
+	t_coro		*co;
+	int			i;
+
+	engine = &thief->data->engine;
+	i = 1;
+	while (i < engine->count)
+	{
+		victim = &engine->workers[(thief->index + i) % engine->count];
+		co = NULL;
+		pthread_mutex_lock(&victim->mutex);
+		if (victim->count > 0)
+		{
+			victim->count--;
+			co = victim->runq[(victim->head + victim->count)
+				% thief->data->num_philosophers];
+		}
+		pthread_mutex_unlock(&victim->mutex);
+		if (co)
+			return (co);
+		i++;
+	}
+	return (NULL);
+}
+
+/**
+ * @name coro_wake_all
+ * @brief Propagates a simulation stop to every worker
+ *
+ * @param data Pointer to main data structure
+ *
+ * Workers flush their timer heaps on their next pass, so every parked
+ * sleeper resumes at once and sees the stop.
+ */
+void	coro_wake_all(t_data *data)
+{
+	int	i;
+
+	atomic_store_explicit(&data->engine.stop, 1, memory_order_release);
+	i = 0;
+	while (i < data->engine.count)
+	{
+		pthread_mutex_lock(&data->engine.workers[i].mutex);
+		pthread_cond_signal(&data->engine.workers[i].cond);
+		pthread_mutex_unlock(&data->engine.workers[i].mutex);
+		i++;
+	}
+}
+
+/**
+ * @name coro_join
+ * @brief Waits for every worker once all coroutines have finished
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if every worker was joined, FAILURE otherwise
+ */
+int	coro_join(t_data *data)
+{
+	int	i;
+
+	if (data->engine_mode != ENGINE_CORO)
+		return (SUCCESS);
+	i = 0;
+	while (i < data->engine.count)
+	{
+		if (data->engine.workers[i].started
+			&& pthread_join(data->engine.workers[i].thread, NULL) != 0)
+			return (FAILURE);
+		i++;
+	}
+	return (SUCCESS);
+}
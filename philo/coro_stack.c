@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   coro_stack.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 07:02:48 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 07:02:48 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name guard_budget
+ * @brief How many stacks may get a guard page
+ *
+ * @param data Pointer to main data structure
+ * @return int Stacks to guard, all of them if the limit is unknown
+ *
+ * Each guard splits the mapping, so N guarded stacks cost 2N kernel
+ * mappings out of vm.max_map_count. CORO_MAP_RESERVE of them are kept
+ * for thread stacks and libraries, or pthread_create would fail next.
+ */
+static int	guard_budget(t_data *data)
+{
+	char	buf[32];
+	long	budget;
+	ssize_t	len;
+	int		fd;
+
+	fd = open("/proc/sys/vm/max_map_count", O_RDONLY);
+	if (fd < 0)
+		return (data->num_philosophers);
+	len = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (len <= 0)
+		return (data->num_philosophers);
+	buf[len] = '\0';
+	budget = (atol(buf) - CORO_MAP_RESERVE) / 2;
+	if (budget < 0)
+		budget = 0;
+	if (budget > data->num_philosophers)
+		budget = data->num_philosophers;
+	return (budget);
+}
+
+/**
+ * @name guard_stacks
+ * @brief Makes the lowest page of every stack slot inaccessible
+ *
+ * @param data Pointer to main data structure, stacks mapped
+ *
+ * Stacks past the budget, or past an mprotect the kernel refuses, run
+ * unguarded, and a warning says which ones.
+ */
+static void	guard_stacks(t_data *data)
+{
+	int	budget;
+	int	i;
+
+	budget = guard_budget(data);
+	i = 0;
+	while (i < budget && mprotect(data->engine.stacks + (size_t)i
+			* data->engine.stride, data->engine.guard, PROT_NONE) == 0)
+		i++;
+	if (i < data->num_philosophers)
+		fprintf(stderr, "Warning: vm.max_map_count reached, coroutine "
+			"stacks %d to %d have no guard page\n", i + 1,
+			data->num_philosophers);
+}
+
+/**
+ * @name coro_map_stacks
+ * @brief Maps one stack per coroutine, each above a guard page
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if the stacks are mapped, FAILURE otherwise
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ low                                        high │
+ * │ [guard][stack 0 ][guard][stack 1 ][guard]...    │
+ * │  none   64 KiB    none   64 KiB                 │
+ * │                                                 │
+ * │ Stacks grow down: an overflow of stack 1 hits   │
+ * │ its guard and faults, instead of silently       │
+ * │ overwriting the top of stack 0                  │
+ * └─────────────────────────────────────────────────┘
+ */
+int	coro_map_stacks(t_data *data)
+{
+	long	page;
+
+	page = sysconf(_SC_PAGESIZE);
+	if (page <= 0)
+		page = 4096;
+	data->engine.guard = page;
+	data->engine.stride = page + CORO_STACK_SIZE;
+	data->engine.stacks = mmap(NULL, data->engine.stride
+			* data->num_philosophers, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (data->engine.stacks == MAP_FAILED)
+	{
+		data->engine.stacks = NULL;
+		return (FAILURE);
+	}
+	guard_stacks(data);
+	return (SUCCESS);
+}
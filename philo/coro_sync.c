@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   coro_sync.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:18:30 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/18 14:18:30 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name coro_park
+ * @brief Switches from the running coroutine back to its worker
+ *
+ * @param co Coroutine giving up its worker
+ * @param held Mutex to release once co's context is saved, or NULL
+ *
+ * Releasing held from the worker side closes the window in which another
+ * thread could resume co (after finding it in a queue guarded by held)
+ * before swapcontext has finished saving it.
+ */
+static void	coro_park(t_coro *co, pthread_mutex_t *held)
+{
+	co->worker->unlock_after = held;
+	swapcontext(&co->ctx, &co->worker->sched);
+}
+
+/**
+ * @name coro_sleep_until
+ * @brief Parks a coroutine in its worker's timer heap until a deadline
+ *
+ * @param philo Pointer to philosopher structure
+ * @param deadline Absolute wake-up time in microseconds (get_time_us)
+ * @return int SUCCESS at the deadline, FAILURE if the simulation stopped
+ *
+ * On stop the worker flushes its whole timer heap, so parked sleepers
+ * resume at once and report FAILURE.
+ */
+int	coro_sleep_until(t_philo *philo, long long deadline)
+{
+	t_coro	*co;
+
+	co = philo->coro;
+	if (atomic_load_explicit(&philo->data->engine.stop, memory_order_acquire))
+		return (FAILURE);
+	if (get_time_us() < deadline)
+	{
+		co->wake = deadline;
+		timer_push(co->worker, co);
+		coro_park(co, NULL);
+	}
+	if (atomic_load_explicit(&philo->data->engine.stop, memory_order_acquire))
+		return (FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @name coro_fork_take
+ * @brief Takes a free fork, or queues behind its holder and parks
+ *
+ * @param philo Pointer to philosopher structure
+ * @param fork Fork to take
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ free:  held = 1, continue                       │
+ * │ taken: append to wait FIFO, park; the holder's  │
+ * │        drop hands the fork over (held stays 1)  │
+ * │        and requeues us on our worker            │
+ * └─────────────────────────────────────────────────┘
+ */
+void	coro_fork_take(t_philo *philo, t_fork *fork)
+{
+	t_coro	*co;
+
+	co = philo->coro;
+	pthread_mutex_lock(&fork->mutex);
+	if (!fork->held)
+	{
+		fork->held = 1;
+		pthread_mutex_unlock(&fork->mutex);
+		return ;
+	}
+	co->next = NULL;
+	if (fork->wait_tail)
+		fork->wait_tail->next = co;
+	else
+		fork->wait_head = co;
+	fork->wait_tail = co;
+	coro_park(co, &fork->mutex);
+}
+
+/**
+ * @name coro_fork_drop
+ * @brief Releases a fork, handing it to the first parked waiter if any
+ *
+ * @param philo Pointer to philosopher structure
+ * @param fork Fork to release
+ */
+void	coro_fork_drop(t_philo *philo, t_fork *fork)
+{
+	t_coro	*next;
+
+	(void)philo;
+	pthread_mutex_lock(&fork->mutex);
+	next = fork->wait_head;
+	if (next)
+	{
+		fork->wait_head = next->next;
+		if (!fork->wait_head)
+			fork->wait_tail = NULL;
+	}
+	else
+		fork->held = 0;
+	pthread_mutex_unlock(&fork->mutex);
+	if (next)
+		runq_push(next->worker, next);
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   coro_timer.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:27:12 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/18 14:27:12 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name timer_swap
+ * @brief Exchanges two entries of a worker's timer heap
+ *
+ * @param w Worker owning the heap
+ * @param i First index
+ * @param j Second index
+ */
+static void	timer_swap(t_worker *w, int i, int j)
+{
+	t_coro	*tmp;
+
+	tmp = w->timers[i];
+	w->timers[i] = w->timers[j];
+	w->timers[j] = tmp;
+}
+
+/**
+ * @name timer_push
+ * @brief Adds a parked coroutine to the worker's timer min-heap
+ *
+ * @param w Worker running the coroutine
+ * @param co Coroutine keyed by co->wake
+ */
+void	timer_push(t_worker *w, t_coro *co)
+{
+	int	i;
+
+	i = w->ntimers;
+	w->timers[i] = co;
+	w->ntimers++;
+	while (i > 0 && w->timers[(i - 1) / 2]->wake > w->timers[i]->wake)
+	{
+		timer_swap(w, i, (i - 1) / 2);
+		i = (i - 1) / 2;
+	}
+}
+
+/**
+ * @name timer_pop
+ * @brief Removes and returns the coroutine with the earliest wake time
+ *
+ * @param w Worker owning the heap
+ * @return t_coro* Earliest sleeper, NULL if the heap is empty
+ */
+t_coro	*timer_pop(t_worker *w)
+{
+	t_coro	*top;
+	int		i;
+	int		child;
+
+	if (w->ntimers == 0)
+		return (NULL);
+	top = w->timers[0];
+	w->ntimers--;
+	w->timers[0] = w->timers[w->ntimers];
+	i = 0;
+	while (2 * i + 1 < w->ntimers)
+	{
+		child = 2 * i + 1;
+		if (child + 1 < w->ntimers
+			&& w->timers[child + 1]->wake < w->timers[child]->wake)
+			child++;
+		if (w->timers[i]->wake <= w->timers[child]->wake)
+			break ;
+		timer_swap(w, i, child);
+		i = child;
+	}
+	return (top);
+}
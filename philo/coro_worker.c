@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   coro_worker.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:49:03 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 06:24:50 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name run_coro
+ * @brief Resumes a coroutine until it parks or finishes
+ *
+ * @param w Worker lending its thread
+ * @param co Coroutine to run
+ */
+static void	run_coro(t_worker *w, t_coro *co)
+{
+	co->worker = w;
+	swapcontext(&w->sched, &co->ctx);
+	if (w->unlock_after)
+	{
+		pthread_mutex_unlock(w->unlock_after);
+		w->unlock_after = NULL;
+	}
+}
+
+/**
+ * @name fire_timers
+ * @brief Moves due sleepers (all of them after a stop) to the run queue
+ *
+ * @param w Worker owning the timer heap
+ */
+static void	fire_timers(t_worker *w)
+{
+	long long	now;
+	int			stop;
+
+	now = get_time_us();
+	stop = atomic_load_explicit(&w->data->engine.stop, memory_order_acquire);
+	while (w->ntimers > 0 && (stop || w->timers[0]->wake <= now))
+		runq_push(w, timer_pop(w));
+}
+
+/**
+ * @name idle_wait
+ * @brief Blocks an idle worker until its next timer or a wakeup
+ *
+ * @param w Idle worker
+ *
+ * The wait is capped at 1 ms so an idle worker keeps trying to steal
+ * from busy peers and notices the end of the run.
+ */
+static void	idle_wait(t_worker *w)
+{
+	struct timespec	abs;
+	long long		until;
+
+	until = get_time_us() + 1000;
+	if (w->ntimers > 0 && w->timers[0]->wake < until)
+		until = w->timers[0]->wake;
+	abs.tv_sec = until / 1000000;
+	abs.tv_nsec = (until % 1000000) * 1000;
+	pthread_mutex_lock(&w->mutex);
+	if (w->count == 0)
+		pthread_cond_timedwait(&w->cond, &w->mutex, &abs);
+	pthread_mutex_unlock(&w->mutex);
+}
+
+/**
+ * @name coro_worker_main
+ * @brief Scheduler loop of one worker thread
+ *
+ * @param arg Void pointer to the worker
+ * @return void* NULL
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ Worker Loop (until every coroutine finished):   │
+ * │                                                 │
+ * │ 1. Due timers → own run queue                   │
+ * │ 2. Pop own queue (FIFO)                         │
+ * │ 3. Empty? steal the newest entry of a peer      │
+ * │ 4. Run it until it parks (fork, sleep) or ends  │
+ * │ 5. Nothing at all? wait for timer or wakeup     │
+ * └─────────────────────────────────────────────────┘
+ */
+void	*coro_worker_main(void *arg)
+{
+	t_worker	*w;
+	t_coro		*co;
+
+	w = (t_worker *)arg;
+	while (atomic_load_explicit(&w->data->engine.finished,
+			memory_order_acquire) < w->data->num_philosophers)
+	{
+		fire_timers(w);
+		co = runq_pop(w);
+		if (!co)
+			co = runq_steal(w);
+		if (co)
+			run_coro(w, co);
+		else
+			idle_wait(w);
+	}
+	return (NULL);
+}
+
+/**
+ * @name coro_start
+ * @brief Launches the worker threads once the start gate is open
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if every worker was created (or engine is threads)
+ */
+int	coro_start(t_data *data)
+{
+	int	i;
+
+	if (data->engine_mode != ENGINE_CORO)
+		return (SUCCESS);
+	i = 0;
+	while (i < data->engine.count)
+	{
+		if (pthread_create(&data->engine.workers[i].thread,
+				&data->thread_attr, coro_worker_main,
+				&data->engine.workers[i]) != 0)
+			return (FAILURE);
+		data->engine.workers[i].started = 1;
+		i++;
+	}
+	return (SUCCESS);
+}
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deadline_heap.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:02:37 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 03:02:37 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name deadline_init
+ * @brief Carves a deadline heap able to hold every philosopher
+ *
+ * @param data Pointer to main data structure, arena mapped
+ * @param dl Heap to initialize
+ * @param count Number of philosophers it will track
+ * @return int SUCCESS if allocation succeeded, FAILURE otherwise
+ */
+int	deadline_init(t_data *data, t_deadlines *dl, int count)
+{
+	dl->heap = arena_alloc(data, sizeof(t_deadline) * count);
+	if (!dl->heap)
+		return (FAILURE);
+	dl->size = count;
+	return (SUCCESS);
+}
+
+/**
+ * @name sift_down
+ * @brief Moves an entry down until both children have later deadlines
+ *
+ * @param dl Heap to repair
+ * @param i Index of the entry whose key grew
+ */
+static void	sift_down(t_deadlines *dl, int i)
+{
+	t_deadline	tmp;
+	int			child;
+
+	while (2 * i + 1 < dl->size)
+	{
+		child = 2 * i + 1;
+		if (child + 1 < dl->size
+			&& dl->heap[child + 1].key < dl->heap[child].key)
+			child++;
+		if (dl->heap[i].key <= dl->heap[child].key)
+			return ;
+		tmp = dl->heap[i];
+		dl->heap[i] = dl->heap[child];
+		dl->heap[child] = tmp;
+		i = child;
+	}
+}
+
+/**
+ * @name deadline_reset
+ * @brief Loads a shard's death deadlines and heapifies them
+ *
+ * @param dl Heap to fill
+ * @param data Pointer to main data structure
+ * @param first Index of the shard's first philosopher
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ key = last_meal_time + time_to_die  (ms)        │
+ * │                                                 │
+ * │ heap[0] always holds the earliest key; keys     │
+ * │ are lower bounds, since meals only push a real  │
+ * │ deadline later, never earlier                   │
+ * └─────────────────────────────────────────────────┘
+ */
+void	deadline_reset(t_deadlines *dl, t_data *data, int first)
+{
+	int	i;
+
+	i = 0;
+	while (i < dl->size)
+	{
+		dl->heap[i].idx = first + i;
+		dl->heap[i].key = atomic_load_explicit(
+				&data->meals.last_meal_time[first + i], memory_order_acquire)
+			+ data->time_to_die;
+		i++;
+	}
+	i = dl->size / 2;
+	while (i >= 0)
+	{
+		sift_down(dl, i);
+		i--;
+	}
+}
+
+/**
+ * @name deadline_rekey
+ * @brief Replaces the earliest deadline with a later one
+ *
+ * @param dl Heap to update
+ * @param key New deadline of the philosopher at heap[0]
+ *
+ * O(log N): called at most once per meal, when the philosopher's stale
+ * key reaches the top.
+ */
+void	deadline_rekey(t_deadlines *dl, long long key)
+{
+	if (key == dl->heap[0].key)
+		return ;
+	dl->heap[0].key = key;
+	sift_down(dl, 0);
+}
@@ -0,0 +1,186 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   des_engine.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:27:50 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 06:55:12 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name des_alloc
+ * @brief Carves the event heap, virtual philosophers, fork table and
+ *        output buffer out of the arena
+ *
+ * @param des Simulation state to fill
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if every allocation succeeded, FAILURE otherwise
+ */
+static int	des_alloc(t_des *des, t_data *data)
+{
+	int	n;
+
+	n = data->num_philosophers;
+	memset(des, 0, sizeof(t_des));
+	des->data = data;
+	des->heap = arena_alloc(data, sizeof(t_des_event) * n * 2);
+	des->ph = arena_alloc(data, sizeof(t_des_philo) * n);
+	des->owner = arena_alloc(data, sizeof(int) * n * 3);
+	des->buf = arena_alloc(data, LOG_BUF_SIZE);
+	if (!des->heap || !des->ph || !des->owner || !des->buf)
+		return (FAILURE);
+	des->wait_head = des->owner + n;
+	des->wait_tail = des->owner + 2 * n;
+	memset(des->owner, -1, sizeof(int) * n * 3);
+	des->remaining = n;
+	return (SUCCESS);
+}
+
+/**
+ * @name des_seed
+ * @brief Places every philosopher at the start line
+ *
+ * @param des Simulation state
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ odd id  → DES_READY at 0 µs                     │
+ * │ even id → DES_READY at 1000 µs (the stagger of  │
+ * │           init_philosopher_state)               │
+ * │ each    → DES_DEATH at start + time_to_die      │
+ * │                                                 │
+ * │ Fork order comes from setup_forks, so both      │
+ * │ engines break the symmetry the same way         │
+ * └─────────────────────────────────────────────────┘
+ */
+static void	des_seed(t_des *des)
+{
+	t_fork		*first;
+	t_fork		*second;
+	t_des_philo	*ph;
+	int			i;
+
+	i = 0;
+	while (i < des->data->num_philosophers)
+	{
+		ph = &des->ph[i];
+		setup_forks(&des->data->philosophers[i], &first, &second);
+		ph->first = first->id;
+		ph->second = second->id;
+		ph->last_meal = 1000 * (des->data->philosophers[i].id % 2 == 0);
+		ph->phase_end = ph->last_meal;
+		ph->meals = 0;
+		ph->eating = 0;
+		des_push(des, i, DES_READY, ph->last_meal);
+		des_push(des, i, DES_DEATH,
+			(ph->last_meal / 1000 + des->data->time_to_die) * 1000);
+		i++;
+	}
+}
+
+/**
+ * @name des_flush
+ * @brief Writes the buffered log lines to data->out_fd (or the --trace
+ *        file)
+ *
+ * @param des Simulation state
+ * @return int SUCCESS if everything was written, FAILURE otherwise
+ */
+static int	des_flush(t_des *des)
+{
+	ssize_t	done;
+	int		off;
+	int		fd;
+
+	off = 0;
+	fd = des->data->out_fd;
+	if (des->data->trace_path)
+		fd = des->data->trace_fd;
+	while (off < des->len)
+	{
+		done = write(fd, des->buf + off, des->len - off);
+		if (done <= 0)
+			return (FAILURE);
+		off += done;
+	}
+	des->len = 0;
+	return (SUCCESS);
+}
+
+/**
+ * @name des_log
+ * @brief Appends one status line stamped with the virtual clock
+ *
+ * @param des Simulation state
+ * @param i Philosopher index
+ * @param state Status to print
+ *
+ * Lines are byte-for-byte those of print_status (or trace records that
+ * philo_trace decodes into them); nothing is printed once the
+ * simulation has stopped.
+ */
+void	des_log(t_des *des, int i, t_state state)
+{
+	t_event	ev;
+
+	if (des->stop || des->data->log_mode == LOG_NONE)
+		return ;
+	if (des->len + LOG_LINE_SIZE > LOG_BUF_SIZE
+		&& des_flush(des) == FAILURE)
+	{
+		des->stop = 1;
+		return ;
+	}
+	ev.ts = des->now / 1000;
+	ev.id = i + 1;
+	ev.state = state;
+	if (des->data->trace_path)
+		des->len += trace_record(des->buf + des->len, &des->last_ts, &ev);
+	else
+		des->len += format_line(des->buf + des->len,
+				&des->data->philosophers[i], ev.ts, state);
+}
+
+/**
+ * @name des_run
+ * @brief Runs the whole simulation in virtual time on the calling thread
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if the run completed, FAILURE otherwise
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ pop earliest event → now = event time → handle  │
+ * │                                                 │
+ * │ Ends on a death, when every meal is eaten, when │
+ * │ the queue empties, or past --until=MS. No       │
+ * │ thread sleeps, so an hour of simulated dinner   │
+ * │ costs only the events it contains               │
+ * └─────────────────────────────────────────────────┘
+ */
+int	des_run(t_data *data)
+{
+	t_des		des;
+	t_des_event	ev;
+	int			status;
+
+	status = des_alloc(&des, data);
+	if (status == SUCCESS)
+		des_seed(&des);
+	while (status == SUCCESS && !des.stop && des.size > 0)
+	{
+		ev = des_pop(&des);
+		if (data->until && ev.time > data->until)
+			break ;
+		des.now = ev.time;
+		des_dispatch(&des, &ev);
+	}
+	if (status == SUCCESS)
+		status = des_flush(&des);
+	return (status);
+}
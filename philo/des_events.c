@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   des_events.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:19:05 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 04:31:08 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name on_ready
+ * @brief Top of the philosopher loop: stop if full, else reach for forks
+ *
+ * @param des Simulation state
+ * @param i Philosopher index
+ */
+static void	on_ready(t_des *des, int i)
+{
+	if (des->data->must_eat_count != -1
+		&& des->ph[i].meals >= des->data->must_eat_count)
+		return ;
+	des_fork_try(des, i, des->ph[i].first);
+}
+
+/**
+ * @name on_eat_end
+ * @brief Finishes a meal: count it, put the forks down, go to sleep
+ *
+ * @param des Simulation state
+ * @param i Philosopher index
+ *
+ * Forks are dropped second then first, like philo_eat. The last meal
+ * owed ends the run at once; the threaded monitor notices it within a
+ * millisecond.
+ */
+static void	on_eat_end(t_des *des, int i)
+{
+	t_des_philo	*ph;
+
+	ph = &des->ph[i];
+	ph->eating = 0;
+	ph->meals++;
+	if (ph->meals == des->data->must_eat_count)
+	{
+		des->remaining--;
+		if (des->remaining == 0)
+			des->stop = 1;
+	}
+	des_fork_drop(des, ph->second);
+	des_fork_drop(des, ph->first);
+	des_log(des, i, ST_SLEEP);
+	ph->phase_end += des->data->time_to_sleep * 1000LL;
+	des_push(des, i, DES_SLEEP_END, ph->phase_end);
+}
+
+/**
+ * @name on_sleep_end
+ * @brief Wakes up and thinks for as long as philo_think would
+ *
+ * @param des Simulation state
+ * @param i Philosopher index
+ */
+static void	on_sleep_end(t_des *des, int i)
+{
+	long long	wake;
+
+	des_log(des, i, ST_THINK);
+	wake = des->now + THINK_FIXED_US;
+	if (des->data->think_mode == THINK_ADAPTIVE)
+		wake = think_until(des->data, des->ph[i].phase_end);
+	if (wake < des->now)
+		wake = des->now;
+	des_push(des, i, DES_READY, wake);
+}
+
+/**
+ * @name on_death
+ * @brief The monitor's check for one philosopher, run at its deadline
+ *
+ * @param des Simulation state
+ * @param i Philosopher index
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ deadline = last_meal (ms) + time_to_die         │
+ * │                                                 │
+ * │ reached, not eating → "died", stop              │
+ * │ reached, eating     → check again in 1 ms       │
+ * │ moved by a meal     → check at the new deadline │
+ * │                                                 │
+ * │ Same rule as check_due_philo, without the       │
+ * │ monitor's wake-up lag                           │
+ * └─────────────────────────────────────────────────┘
+ */
+static void	on_death(t_des *des, int i)
+{
+	long long	deadline;
+	long long	now;
+
+	now = des->now / 1000;
+	deadline = des->ph[i].last_meal / 1000 + des->data->time_to_die;
+	if (deadline <= now && !des->ph[i].eating)
+	{
+		des_log(des, i, ST_DIED);
+		des->data->died = i + 1;
+		des->stop = 1;
+		return ;
+	}
+	if (deadline <= now)
+		deadline = now + 1;
+	des_push(des, i, DES_DEATH, deadline * 1000);
+}
+
+/**
+ * @name des_dispatch
+ * @brief Runs the handler for one event at its virtual time
+ *
+ * @param des Simulation state, with des->now set to the event's time
+ * @param ev Event to process
+ */
+void	des_dispatch(t_des *des, t_des_event *ev)
+{
+	if (ev->kind == DES_READY)
+		on_ready(des, ev->philo);
+	else if (ev->kind == DES_GOT_FORK)
+		des_got_fork(des, ev->philo);
+	else if (ev->kind == DES_EAT_END)
+		on_eat_end(des, ev->philo);
+	else if (ev->kind == DES_SLEEP_END)
+		on_sleep_end(des, ev->philo);
+	else
+		on_death(des, ev->philo);
+}
@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   des_forks.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:11:37 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 03:31:08 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name des_holding
+ * @brief Continues a philosopher that has just been given a fork
+ *
+ * @param des Simulation state
+ * @param i Philosopher index
+ * @param fork Fork index it now owns
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ first fork  → "has taken a fork", try second    │
+ * │ second fork → "has taken a fork", "is eating",  │
+ * │               DES_EAT_END at now + time_to_eat  │
+ * │                                                 │
+ * │ A lone philosopher keeps its only fork and      │
+ * │ waits for its death check, as in philo_alone    │
+ * └─────────────────────────────────────────────────┘
+ */
+static void	des_holding(t_des *des, int i, int fork)
+{
+	t_des_philo	*ph;
+
+	ph = &des->ph[i];
+	des_log(des, i, ST_FORK);
+	if (fork == ph->first)
+	{
+		if (des->data->num_philosophers > 1)
+			des_fork_try(des, i, ph->second);
+		return ;
+	}
+	ph->eating = 1;
+	ph->last_meal = des->now;
+	ph->phase_end = des->now;
+	des_log(des, i, ST_EAT);
+	ph->phase_end += des->data->time_to_eat * 1000LL;
+	des_push(des, i, DES_EAT_END, ph->phase_end);
+}
+
+/**
+ * @name des_fork_try
+ * @brief Takes a fork if it is free, otherwise queues for it
+ *
+ * @param des Simulation state
+ * @param i Philosopher index
+ * @param fork Fork index, in the order chosen by setup_forks
+ *
+ * Waiters are served first come, first served, like the coroutine
+ * engine's fork queues.
+ */
+void	des_fork_try(t_des *des, int i, int fork)
+{
+	if (des->owner[fork] == -1)
+	{
+		des->owner[fork] = i;
+		des_holding(des, i, fork);
+		return ;
+	}
+	des->ph[i].next = -1;
+	if (des->wait_tail[fork] == -1)
+		des->wait_head[fork] = i;
+	else
+		des->ph[des->wait_tail[fork]].next = i;
+	des->wait_tail[fork] = i;
+}
+
+/**
+ * @name des_fork_drop
+ * @brief Releases a fork, handing it to the oldest waiter
+ *
+ * @param des Simulation state
+ * @param fork Fork index
+ *
+ * The waiter resumes through a DES_GOT_FORK event at the same instant,
+ * so the dropping philosopher's "is sleeping" line comes first.
+ */
+void	des_fork_drop(t_des *des, int fork)
+{
+	int	w;
+
+	w = des->wait_head[fork];
+	des->owner[fork] = w;
+	if (w == -1)
+		return ;
+	des->wait_head[fork] = des->ph[w].next;
+	if (des->wait_head[fork] == -1)
+		des->wait_tail[fork] = -1;
+	des->ph[w].waiting = fork;
+	des_push(des, w, DES_GOT_FORK, des->now);
+}
+
+/**
+ * @name des_got_fork
+ * @brief Handles DES_GOT_FORK for a philosopher handed a fork
+ *
+ * @param des Simulation state
+ * @param i Philosopher index
+ */
+void	des_got_fork(t_des *des, int i)
+{
+	des_holding(des, i, des->ph[i].waiting);
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   des_queue.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:04:12 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/18 16:04:12 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name des_before
+ * @brief Total order of the event queue
+ *
+ * @param a First event
+ * @param b Second event
+ * @return int 1 if a must be processed before b
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ (time, kind == DES_DEATH, seq)                  │
+ * │                                                 │
+ * │ seq makes equal-time events FIFO, so a run is   │
+ * │ fully deterministic for a given input           │
+ * └─────────────────────────────────────────────────┘
+ */
+static int	des_before(t_des_event *a, t_des_event *b)
+{
+	if (a->time != b->time)
+		return (a->time < b->time);
+	if ((a->kind == DES_DEATH) != (b->kind == DES_DEATH))
+		return (b->kind == DES_DEATH);
+	return (a->seq < b->seq);
+}
+
+/**
+ * @name des_push
+ * @brief Schedules an event for a philosopher
+ *
+ * @param des Simulation state
+ * @param philo Philosopher index
+ * @param kind What happens
+ * @param time Virtual time in µs
+ *
+ * The heap never holds more than two events per philosopher (its next
+ * action and its death check), so it is allocated once with that size.
+ */
+void	des_push(t_des *des, int philo, t_des_kind kind, long long time)
+{
+	t_des_event	ev;
+	int			i;
+
+	ev.time = time;
+	ev.seq = des->seq;
+	ev.philo = philo;
+	ev.kind = kind;
+	des->seq++;
+	i = des->size;
+	des->size++;
+	while (i > 0 && des_before(&ev, &des->heap[(i - 1) / 2]))
+	{
+		des->heap[i] = des->heap[(i - 1) / 2];
+		i = (i - 1) / 2;
+	}
+	des->heap[i] = ev;
+}
+
+/**
+ * @name des_pop
+ * @brief Removes and returns the earliest event
+ *
+ * @param des Simulation state, with at least one queued event
+ * @return t_des_event The event that happens next
+ */
+t_des_event	des_pop(t_des *des)
+{
+	t_des_event	top;
+	t_des_event	last;
+	int			i;
+	int			child;
+
+	top = des->heap[0];
+	des->size--;
+	last = des->heap[des->size];
+	i = 0;
+	while (2 * i + 1 < des->size)
+	{
+		child = 2 * i + 1;
+		if (child + 1 < des->size
+			&& des_before(&des->heap[child + 1], &des->heap[child]))
+			child++;
+		if (!des_before(&des->heap[child], &last))
+			break ;
+		des->heap[i] = des->heap[child];
+		i = child;
+	}
+	des->heap[i] = last;
+	return (top);
+}
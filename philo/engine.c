@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   engine.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:02:55 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 07:34:40 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name engine_run
+ * @brief Runs the simulation with the selected engine
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if the run completed, FAILURE otherwise
+ *
+ * --engine=des needs no threads at all; the other engines share
+ * create_threads, after which the --shm table is marked stopped and the
+ * --latency and --lock-stats reports are printed.
+ */
+int	engine_run(t_data *data)
+{
+	int	status;
+
+	if (data->engine_mode == ENGINE_DES)
+		return (des_run(data));
+	status = create_threads(data);
+	shm_phase(data, SHM_STOPPED, 0);
+	if (status == SUCCESS)
+	{
+		latency_report(data);
+		lock_stats_report(data);
+	}
+	return (status);
+}
+
+/**
+ * @name engine_sleep_until
+ * @brief Sleeps a philosopher until an absolute deadline or simulation stop
+ *
+ * @param philo Pointer to philosopher structure
+ * @param deadline Absolute wake-up time in microseconds (get_time_us)
+ * @return int SUCCESS at the deadline, FAILURE if the simulation stopped
+ *
+ * Threads block their OS thread; coroutines park and free their worker.
+ */
+int	engine_sleep_until(t_philo *philo, long long deadline)
+{
+	if (philo->data->engine_mode == ENGINE_CORO)
+		return (coro_sleep_until(philo, deadline));
+	return (sleep_until(philo->data, deadline));
+}
+
+/**
+ * @name engine_pause
+ * @brief Short, non-interruptible pause (start stagger, thinking)
+ *
+ * @param philo Pointer to philosopher structure
+ * @param time_in_us Pause length in microseconds
+ */
+void	engine_pause(t_philo *philo, long long time_in_us)
+{
+	if (philo->data->engine_mode == ENGINE_CORO)
+		coro_sleep_until(philo, get_time_us() + time_in_us);
+	else
+		usleep(time_in_us);
+}
+
+/**
+ * @name mutex_take
+ * @brief Takes a fork guarded by a bare pthread mutex (the default)
+ *
+ * @param philo Taker (unused, for the take action's signature)
+ * @param fork Fork to take
+ */
+void	mutex_take(t_philo *philo, t_fork *fork)
+{
+	(void)philo;
+	pthread_mutex_lock(&fork->mutex);
+}
+
+/**
+ * @name mutex_drop
+ * @brief Puts back a fork guarded by a bare pthread mutex
+ *
+ * @param philo Holder (unused, for the drop action's signature)
+ * @param fork Fork to release
+ */
+void	mutex_drop(t_philo *philo, t_fork *fork)
+{
+	(void)philo;
+	pthread_mutex_unlock(&fork->mutex);
+}
@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   engine_size.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:52:30 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 06:52:30 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name coro_worker_count
+ * @brief Number of worker threads --engine=coro will run
+ *
+ * @param data Pointer to main data structure, options parsed
+ * @return int --workers=N, else one per online CPU, never more than
+ *             there are philosophers and never fewer than one
+ */
+int	coro_worker_count(t_data *data)
+{
+	long	count;
+
+	count = data->worker_count;
+	if (count <= 0)
+		count = sysconf(_SC_NPROCESSORS_ONLN);
+	if (count <= 0)
+		count = 1;
+	if (count > data->num_philosophers)
+		count = data->num_philosophers;
+	return (count);
+}
+
+/**
+ * @name engine_arena_size
+ * @brief Arena bytes the selected engine carves out on top of the seats
+ *
+ * @param data Pointer to main data structure, options parsed
+ * @return size_t Bytes for the coroutine or DES arrays, 0 for threads
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ coro  workers[W], coros[N], and per worker a    │
+ * │       run queue and a timer heap of N pointers  │
+ * │ des   event heap[2N], philosophers[N],          │
+ * │       fork table[3N ints], output buffer        │
+ * │                                                 │
+ * │ The coroutine stacks stay in their own          │
+ * │ MAP_NORESERVE mapping, outside the arena        │
+ * └─────────────────────────────────────────────────┘
+ */
+size_t	engine_arena_size(t_data *data)
+{
+	size_t	n;
+	size_t	w;
+
+	n = data->num_philosophers;
+	if (data->engine_mode == ENGINE_DES)
+		return (line_round(sizeof(t_des_event) * n * 2)
+			+ line_round(sizeof(t_des_philo) * n)
+			+ line_round(sizeof(int) * n * 3) + line_round(LOG_BUF_SIZE));
+	if (data->engine_mode != ENGINE_CORO)
+		return (0);
+	w = coro_worker_count(data);
+	return (line_round(sizeof(t_worker) * w) + line_round(sizeof(t_coro) * n)
+		+ 2 * w * line_round(sizeof(t_coro *) * n));
+}
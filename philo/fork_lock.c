@@ -0,0 +1,157 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_lock.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:21:40 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 08:29:51 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name try_word
+ * @brief One attempt at a --fork-lock=spin fork
+ *
+ * @param fork Fork to take
+ * @return int 1 if the fork was free and is now taken, 0 otherwise
+ *
+ * A plain load first, so a spinning taker only reads the line the
+ * holder will write and never bounces it with failed exchanges.
+ */
+static int	try_word(t_fork *fork)
+{
+	int	seen;
+
+	seen = LOCK_FREE;
+	return (atomic_load_explicit(&fork->word, memory_order_relaxed)
+		== LOCK_FREE && atomic_compare_exchange_strong_explicit(&fork->word,
+			&seen, LOCK_TAKEN, memory_order_acquire, memory_order_relaxed));
+}
+
+/**
+ * @name spin_park
+ * @brief Sleeps on a --fork-lock=spin fork until it is taken
+ *
+ * @param philo Taker
+ * @param fork Fork to take
+ *
+ * The word is swapped to "waited" rather than "taken", so the drop
+ * that frees it knows someone may be asleep and issues the wake.
+ */
+static void	spin_park(t_philo *philo, t_fork *fork)
+{
+	int	seen;
+
+	seen = atomic_exchange_explicit(&fork->word, LOCK_WAITED,
+			memory_order_acquire);
+	while (seen != LOCK_FREE)
+	{
+		futex_wait(&fork->word, LOCK_WAITED);
+		philo->lock_stats[LOCK_PARKS]++;
+		seen = atomic_exchange_explicit(&fork->word, LOCK_WAITED,
+				memory_order_acquire);
+	}
+}
+
+/**
+ * @name fifo_park
+ * @brief Sleeps on a --fork-lock=fifo fork until its ticket is served
+ *
+ * @param philo Taker
+ * @param fork Fork to take
+ * @param ticket Ticket drawn by the taker
+ *
+ * The seq_cst store of word then load of serving is what stops a lost
+ * wakeup: either fifo_drop sees FIFO_PARKED or the parker sees its turn.
+ */
+static void	fifo_park(t_philo *philo, t_fork *fork, int ticket)
+{
+	int	seen;
+
+	while (1)
+	{
+		atomic_store_explicit(&fork->word, FIFO_PARKED, memory_order_seq_cst);
+		seen = atomic_load_explicit(&fork->serving, memory_order_seq_cst);
+		if (seen == ticket)
+			return ;
+		futex_wait(&fork->serving, seen);
+		philo->lock_stats[LOCK_PARKS]++;
+	}
+}
+
+/**
+ * @name spin_take
+ * @brief --fork-lock=spin: try, spin a bounded while, then futex
+ *
+ * @param philo Taker
+ * @param fork Fork to take
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ free → taken           one compare-exchange     │
+ * │ held → spin ≤ budget   the holder often lets go │
+ * │                        within microseconds      │
+ * │ still held → waited    FUTEX_WAIT until a drop  │
+ * │                        sees "waited" and wakes  │
+ * └─────────────────────────────────────────────────┘
+ */
+void	spin_take(t_philo *philo, t_fork *fork)
+{
+	int	budget;
+	int	rounds;
+	int	owned;
+
+	budget = spin_budget(philo, fork);
+	rounds = 0;
+	owned = try_word(fork);
+	while (!owned && rounds < budget)
+	{
+		cpu_relax();
+		rounds++;
+		owned = try_word(fork);
+	}
+	spin_done(philo, fork, rounds, owned);
+	if (!owned)
+		spin_park(philo, fork);
+}
+
+/**
+ * @name fifo_take
+ * @brief --fork-lock=fifo: ticket, bounded spin, then futex
+ *
+ * @param philo Taker
+ * @param fork Fork to take
+ *
+ * Takers are served in ticket order, so a neighbour already waiting is
+ * never overtaken by the holder coming straight back for the fork.
+ * A parker raises word before it re-reads serving, and a drop bumps
+ * serving before it reads word, both sequentially consistent: either
+ * the drop sees the parker and wakes it, or the parker sees its turn.
+ */
+void	fifo_take(t_philo *philo, t_fork *fork)
+{
+	int	ticket;
+	int	budget;
+	int	rounds;
+	int	served;
+
+	ticket = atomic_fetch_add_explicit(&fork->next, 1, memory_order_relaxed);
+	budget = spin_budget(philo, fork);
+	rounds = 0;
+	served = atomic_load_explicit(&fork->serving, memory_order_acquire)
+		== ticket;
+	while (!served && rounds < budget)
+	{
+		cpu_relax();
+		rounds++;
+		served = atomic_load_explicit(&fork->serving, memory_order_acquire)
+			== ticket;
+	}
+	spin_done(philo, fork, rounds, served);
+	if (!served)
+		fifo_park(philo, fork, ticket);
+}
@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_lock_park.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:26:12 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 07:34:40 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name futex_wait
+ * @brief Sleeps while a word still holds a value
+ *
+ * @param word Word to sleep on
+ * @param value Value the caller saw; any other returns at once
+ *
+ * Spurious returns are fine: every caller re-checks its word.
+ */
+void	futex_wait(atomic_int *word, int value)
+{
+	syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+}
+
+/**
+ * @name futex_wake
+ * @brief Wakes threads sleeping on a word
+ *
+ * @param word Word they sleep on
+ * @param count Most sleepers to wake, INT_MAX for all
+ */
+void	futex_wake(atomic_int *word, int count)
+{
+	syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+}
+
+/**
+ * @name thread_switches
+ * @brief Context switches of the calling thread so far
+ *
+ * @return long long Voluntary plus involuntary switches
+ */
+static long long	thread_switches(void)
+{
+	struct rusage	ru;
+
+	getrusage(RUSAGE_THREAD, &ru);
+	return (ru.ru_nvcsw + ru.ru_nivcsw);
+}
+
+/**
+ * @name fork_lock_take
+ * @brief Takes a fork with the lock picked by --fork-lock
+ *
+ * @param philo Taker
+ * @param fork Fork to take
+ *
+ * The take action under --lock-stats only (see bind_actions); without
+ * it the spin, fifo and mutex takes are bound directly. A counted mutex
+ * take is a trylock first, so its fast and parked columns compare with
+ * those of the other locks; a blocked mutex take counts as one park.
+ * The context switches the take itself cost are counted too.
+ */
+void	fork_lock_take(t_philo *philo, t_fork *fork)
+{
+	long long	before;
+
+	before = thread_switches();
+	if (philo->data->lock_mode == LOCK_SPIN)
+		spin_take(philo, fork);
+	else if (philo->data->lock_mode == LOCK_FIFO)
+		fifo_take(philo, fork);
+	else if (pthread_mutex_trylock(&fork->mutex) == 0)
+		philo->lock_stats[LOCK_FAST]++;
+	else
+	{
+		philo->lock_stats[LOCK_PARKED]++;
+		philo->lock_stats[LOCK_PARKS]++;
+		pthread_mutex_lock(&fork->mutex);
+	}
+	philo->lock_stats[LOCK_SWITCHES] += thread_switches() - before;
+}
@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_lock_spin.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:10:12 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 08:29:51 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name spin_budget
+ * @brief How many rounds a taker may spin on a fork before parking
+ *
+ * @param philo Taker
+ * @param fork Fork it wants
+ * @return int Spin rounds, 0 on a single CPU
+ *
+ * Twice the fork's recent average plus a little, capped at spin_max:
+ * the adaptive rule of glibc's PTHREAD_MUTEX_ADAPTIVE_NP. A fork whose
+ * holder tends to let go quickly earns a longer spin, one that always
+ * ends up parking drifts back towards the minimum.
+ */
+int	spin_budget(t_philo *philo, t_fork *fork)
+{
+	int	budget;
+
+	budget = atomic_load_explicit(&fork->spin_avg, memory_order_relaxed)
+		* 2 + 10;
+	if (budget > philo->data->spin_max)
+		budget = philo->data->spin_max;
+	return (budget);
+}
+
+/**
+ * @name spin_done
+ * @brief Counts one take and folds its spin into the fork's average
+ *
+ * @param philo Taker
+ * @param fork Fork taken
+ * @param rounds Failed attempts before the take or the park
+ * @param won 1 if the fork was had without parking
+ */
+void	spin_done(t_philo *philo, t_fork *fork, int rounds, int won)
+{
+	int	avg;
+
+	if (!won)
+		philo->lock_stats[LOCK_PARKED]++;
+	else if (rounds == 0)
+		philo->lock_stats[LOCK_FAST]++;
+	else
+		philo->lock_stats[LOCK_SPUN]++;
+	if (rounds == 0)
+		return ;
+	philo->lock_stats[LOCK_SPINS] += rounds;
+	avg = atomic_load_explicit(&fork->spin_avg, memory_order_relaxed);
+	atomic_store_explicit(&fork->spin_avg, avg + (rounds - avg) / 8,
+		memory_order_relaxed);
+}
+
+/**
+ * @name cpu_relax
+ * @brief Tells the CPU the caller is spinning on a lock word
+ *
+ * Issued once per spin round. On x86 the pause stops the loop from
+ * flooding the pipeline with speculative loads, and leaves the sibling
+ * hyperthread (possibly the holder) the execution units. It also acts
+ * as a compiler barrier, so the next attempt really reloads the word.
+ */
+void	cpu_relax(void)
+{
+	__asm__ volatile (CPU_RELAX ::: "memory");
+}
+
+/**
+ * @name spin_drop
+ * @brief Puts back a --fork-lock=spin fork
+ *
+ * @param philo Holder (unused, for the drop action's signature)
+ * @param fork Fork to release
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ spin: word → free; FUTEX_WAKE one only if it    │
+ * │       was "waited"                              │
+ * │ fifo: serving + 1; FUTEX_WAKE only if a waiter  │
+ * │       raised word before parking                │
+ * │                                                 │
+ * │ Uncontended, a drop is one atomic and no call   │
+ * │ into the kernel                                 │
+ * └─────────────────────────────────────────────────┘
+ */
+void	spin_drop(t_philo *philo, t_fork *fork)
+{
+	(void)philo;
+	if (atomic_exchange_explicit(&fork->word, LOCK_FREE,
+			memory_order_release) == LOCK_WAITED)
+		futex_wake(&fork->word, 1);
+}
+
+/**
+ * @name fifo_drop
+ * @brief Puts back a --fork-lock=fifo fork, serving the next ticket
+ *
+ * @param philo Holder (unused, for the drop action's signature)
+ * @param fork Fork to release
+ */
+void	fifo_drop(t_philo *philo, t_fork *fork)
+{
+	(void)philo;
+	atomic_fetch_add_explicit(&fork->serving, 1, memory_order_seq_cst);
+	if (atomic_exchange_explicit(&fork->word, FIFO_IDLE,
+			memory_order_seq_cst) == FIFO_PARKED)
+		futex_wake(&fork->serving, INT_MAX);
+}
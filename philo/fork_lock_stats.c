@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_lock_stats.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:30:55 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 08:47:13 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name set_lock_mode
+ * @brief Selects the lock inside every fork
+ *
+ * @param data Pointer to the main data structure
+ * @param value "mutex", "spin" or "fifo"
+ * @return int SUCCESS if value names a lock, FAILURE otherwise
+ */
+static int	set_lock_mode(t_data *data, char *value)
+{
+	if (ft_strncmp(value, "mutex", 6) == 0)
+		data->lock_mode = LOCK_MUTEX;
+	else if (ft_strncmp(value, "spin", 5) == 0)
+		data->lock_mode = LOCK_SPIN;
+	else if (ft_strncmp(value, "fifo", 5) == 0)
+		data->lock_mode = LOCK_FIFO;
+	else
+		return (dprintf(data->out_fd, "Error: Invalid fork lock %s\n", value),
+			FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @name apply_lock_option
+ * @brief Applies --fork-lock and --lock-stats
+ *
+ * @param data Pointer to the main data structure
+ * @param opt Raw command-line word starting with "--"
+ * @return int SUCCESS if the option was applied, FAILURE if its value is
+ *             invalid, OPTION_UNKNOWN if it is not one of these
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ --fork-lock=mutex  pthread mutex (default)      │
+ * │ --fork-lock=spin   adaptive spin, then futex    │
+ * │ --fork-lock=fifo   ticket order, adaptive spin, │
+ * │                    then futex                   │
+ * │ --lock-stats       print take counters, parks   │
+ * │                    and context switches per     │
+ * │                    meal to stderr at the end    │
+ * └─────────────────────────────────────────────────┘
+ */
+int	apply_lock_option(t_data *data, char *opt)
+{
+	char	*value;
+
+	value = option_value(opt, "--fork-lock");
+	if (value)
+		return (set_lock_mode(data, value));
+	if (ft_strncmp(opt, "--lock-stats", 13) == 0)
+	{
+		data->lock_stats = 1;
+		return (SUCCESS);
+	}
+	return (OPTION_UNKNOWN);
+}
+
+/**
+ * @name fork_lock_init
+ * @brief Checks the fork lock fits the run and sets the spin cap
+ *
+ * @param data Pointer to the main data structure
+ * @return int SUCCESS if the lock can be used, FAILURE otherwise
+ *
+ * Spinning only pays while the holder runs on another CPU; with one
+ * CPU the holder cannot let go while a taker spins, so spin_max is 0
+ * and the spin and fifo locks park straight away.
+ */
+int	fork_lock_init(t_data *data)
+{
+	if ((data->lock_mode != LOCK_MUTEX || data->lock_stats)
+		&& (data->engine_mode != ENGINE_THREADS
+			|| data->fork_mode != FORKS_ORDERED))
+		return (dprintf(data->out_fd, "Error: --fork-lock and --lock-stats "
+				"need --engine=threads and --forks=ordered\n"), FAILURE);
+	data->spin_max = FORK_SPIN_MAX;
+	if (sysconf(_SC_NPROCESSORS_ONLN) <= 1)
+		data->spin_max = 0;
+	return (SUCCESS);
+}
+
+/**
+ * @name sum_stats
+ * @brief Adds the counters up over every philosopher
+ *
+ * @param data Pointer to the main data structure
+ * @param total LOCK_STAT_COUNT totals to fill
+ * @return long long Meals eaten, at least 1 so it can divide
+ */
+static long long	sum_stats(t_data *data, long long *total)
+{
+	long long	meals;
+	int			i;
+	int			s;
+
+	memset(total, 0, sizeof(long long) * LOCK_STAT_COUNT);
+	meals = 0;
+	i = 0;
+	while (i < data->num_philosophers)
+	{
+		s = 0;
+		while (s < LOCK_STAT_COUNT)
+		{
+			total[s] += data->philosophers[i].lock_stats[s];
+			s++;
+		}
+		meals += atomic_load_explicit(&data->meals.meals_eaten[i],
+				memory_order_relaxed);
+		i++;
+	}
+	return (meals + (meals == 0));
+}
+
+/**
+ * @name lock_stats_report
+ * @brief Prints the fork lock counters once every thread is joined
+ *
+ * @param data Pointer to the main data structure
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ fork lock spin: 4000 takes, 61.2% fast, 3.1%    │
+ * │ spun, 35.7% parked                              │
+ * │   tries per waiting take 14.2, parks per meal   │
+ * │   0.71, context switches per meal 0.74          │
+ * │                                                 │
+ * │ Context switches are those of the takes only    │
+ * │ (RUSAGE_THREAD around each), not the sleeps'    │
+ * └─────────────────────────────────────────────────┘
+ */
+void	lock_stats_report(t_data *data)
+{
+	static const char	*names[] = {"mutex", "spin", "fifo"};
+	long long			t[LOCK_STAT_COUNT];
+	double				takes;
+	double				meals;
+
+	if (!data->lock_stats)
+		return ;
+	meals = sum_stats(data, t);
+	takes = t[LOCK_FAST] + t[LOCK_SPUN] + t[LOCK_PARKED];
+	fprintf(stderr, "fork lock %s: %.0f takes, %.1f%% fast, %.1f%% spun, "
+		"%.1f%% parked\n", names[data->lock_mode], takes,
+		100.0 * t[LOCK_FAST] / (takes + (takes == 0)),
+		100.0 * t[LOCK_SPUN] / (takes + (takes == 0)),
+		100.0 * t[LOCK_PARKED] / (takes + (takes == 0)));
+	takes = t[LOCK_SPUN] + t[LOCK_PARKED];
+	fprintf(stderr, "  tries per waiting take %.1f, parks per meal %.2f, "
+		"context switches per meal %.2f\n",
+		t[LOCK_SPINS] / (takes + (takes == 0)), t[LOCK_PARKS] / meals,
+		t[LOCK_SWITCHES] / meals);
+}
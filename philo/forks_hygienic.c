@@ -0,0 +1,181 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   forks_hygienic.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:14:33 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 07:34:40 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name hygienic_wait
+ * @brief Waits until the philosopher owns a fork
+ *
+ * @param philo Hungry philosopher
+ * @param fork Fork shared with a neighbour
+ * @return int SUCCESS once owned, FAILURE if the simulation stopped
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ owner == me          → done                     │
+ * │ dirty and not in use → the neighbour must give  │
+ * │                        it up: take it, clean    │
+ * │ otherwise            → leave a request token,   │
+ * │                        wait for hygienic_drop   │
+ * └─────────────────────────────────────────────────┘
+ */
+static int	hygienic_wait(t_philo *philo, t_fork *fork)
+{
+	t_data	*data;
+	int		owned;
+
+	data = philo->data;
+	pthread_mutex_lock(&fork->mutex);
+	while (fork->owner != philo->id
+		&& !atomic_load_explicit(&data->hygienic_stop, memory_order_acquire))
+	{
+		if (fork->dirty && !fork->in_use)
+		{
+			fork->owner = philo->id;
+			fork->dirty = 0;
+		}
+		else
+		{
+			fork->requested = philo->id;
+			pthread_cond_wait(&fork->cond, &fork->mutex);
+		}
+	}
+	owned = (fork->owner == philo->id);
+	pthread_mutex_unlock(&fork->mutex);
+	if (owned)
+		return (SUCCESS);
+	return (FAILURE);
+}
+
+/**
+ * @name hygienic_claim
+ * @brief Starts using both forks if they are both still owned
+ *
+ * @param philo Hungry philosopher
+ * @param first Fork it waited for first
+ * @param second Fork it waited for second
+ * @return int 1 if both are now in use, 0 if a dirty one was taken away
+ *             meanwhile
+ *
+ * Both locks are taken lowest fork id first, so two claims never
+ * deadlock.
+ */
+static int	hygienic_claim(t_philo *philo, t_fork *first, t_fork *second)
+{
+	t_fork	*low;
+	t_fork	*high;
+	int		owned;
+
+	low = first;
+	high = second;
+	if (second->id < first->id)
+	{
+		low = second;
+		high = first;
+	}
+	pthread_mutex_lock(&low->mutex);
+	pthread_mutex_lock(&high->mutex);
+	owned = (low->owner == philo->id && high->owner == philo->id);
+	if (owned)
+	{
+		low->in_use = 1;
+		high->in_use = 1;
+	}
+	pthread_mutex_unlock(&high->mutex);
+	pthread_mutex_unlock(&low->mutex);
+	return (owned);
+}
+
+/**
+ * @name hygienic_acquire
+ * @brief Gets both forks under the Chandy-Misra protocol
+ *
+ * @param philo Hungry philosopher
+ * @param first First fork from setup_forks
+ * @param second Second fork from setup_forks
+ * @return int SUCCESS holding both forks, FAILURE if the simulation
+ *             stopped
+ *
+ * Both "has taken a fork" lines are printed once the forks are in use,
+ * so a fork that is taken away again before the meal never shows up in
+ * the log.
+ */
+int	hygienic_acquire(t_philo *philo, t_fork *first, t_fork *second)
+{
+	while (1)
+	{
+		if (hygienic_wait(philo, first) == FAILURE
+			|| hygienic_wait(philo, second) == FAILURE)
+			return (FAILURE);
+		if (hygienic_claim(philo, first, second))
+			break ;
+	}
+	if (check_simulation_stop(philo))
+	{
+		hygienic_drop(philo, second);
+		hygienic_drop(philo, first);
+		return (FAILURE);
+	}
+	philo->data->act.print(philo, ST_FORK);
+	philo->data->act.print(philo, ST_FORK);
+	return (SUCCESS);
+}
+
+/**
+ * @name hygienic_drop
+ * @brief Ends a meal with a fork: it is now dirty, and a waiting
+ *        neighbour gets it at once, cleaned
+ *
+ * @param philo Philosopher that ate
+ * @param fork Fork it ate with
+ */
+void	hygienic_drop(t_philo *philo, t_fork *fork)
+{
+	pthread_mutex_lock(&fork->mutex);
+	fork->in_use = 0;
+	fork->dirty = 1;
+	if (fork->requested && fork->requested != philo->id)
+	{
+		fork->owner = fork->requested;
+		fork->dirty = 0;
+		pthread_cond_broadcast(&fork->cond);
+	}
+	fork->requested = 0;
+	pthread_mutex_unlock(&fork->mutex);
+}
+
+/**
+ * @name hygienic_wake_all
+ * @brief Releases every philosopher waiting for a fork at stop
+ *
+ * @param data Pointer to main data structure
+ *
+ * Called under state_mutex by set_simulation_stop. Fork waiters never
+ * take state_mutex while holding a fork mutex, so the lock order holds;
+ * they read hygienic_stop instead, the atomic copy of the stop flag
+ * raised here before the broadcast.
+ */
+void	hygienic_wake_all(t_data *data)
+{
+	int	i;
+
+	atomic_store_explicit(&data->hygienic_stop, 1, memory_order_release);
+	i = 0;
+	while (i < data->num_philosophers)
+	{
+		pthread_mutex_lock(&data->forks[i].mutex);
+		pthread_cond_broadcast(&data->forks[i].cond);
+		pthread_mutex_unlock(&data->forks[i].mutex);
+		i++;
+	}
+}
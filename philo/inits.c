@@ -6,12 +6,38 @@
 /*   By: mkurkar <mkurkar@student.42amman.com>      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/08 15:56:27 by mkurkar           #+#    #+#             */
-/*   Updated: 2025/05/25 15:51:31 by mkurkar          ###   ########.fr       */
+/*   Updated: 2026/10/19 08:47:13 by mkurkar          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "philosophers.h"
 
+/**
+ * @name init_monotonic_cond
+ * @brief Initializes a condition variable on the monotonic clock
+ *
+ * @param cond Condition variable to initialize
+ * @return int SUCCESS if initialization successful, FAILURE otherwise
+ *
+ * Timed waits are given CLOCK_MONOTONIC deadlines (get_time_us), so the
+ * condition variable must measure them against that same clock.
+ */
+int	init_monotonic_cond(pthread_cond_t *cond)
+{
+	pthread_condattr_t	attr;
+
+	if (pthread_condattr_init(&attr) != 0)
+		return (FAILURE);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	if (pthread_cond_init(cond, &attr) != 0)
+	{
+		pthread_condattr_destroy(&attr);
+		return (FAILURE);
+	}
+	pthread_condattr_destroy(&attr);
+	return (SUCCESS);
+}
+
 /**
  * @name init_data
  * @brief Initializes the main data structure with program arguments
@@ -37,7 +63,8 @@
 int	init_data(t_data *data, int argc, char **argv)
 {
 	if (argc < 5 || argc > 6)
-		return (printf("Error: Invalid number of arguments\n"), FAILURE);
+		return (dprintf(data->out_fd, "Error: Invalid number of arguments\n"),
+			FAILURE);
 	data->num_philosophers = ft_atoi(argv[1]);
 	data->time_to_die = ft_atoi(argv[2]);
 	data->time_to_eat = ft_atoi(argv[3]);
@@ -48,10 +75,12 @@ int	init_data(t_data *data, int argc, char **argv)
 	if (data->num_philosophers <= 0 || data->time_to_die <= 0
 		|| data->time_to_eat <= 0 || data->time_to_sleep <= 0 || (argc == 6
 			&& data->must_eat_count <= 0))
-		return (printf("Error: Invalid arguments\n"), FAILURE);
+		return (dprintf(data->out_fd, "Error: Invalid arguments\n"), FAILURE);
 	data->print_mutex = (pthread_mutex_t)PTHREAD_MUTEX_INITIALIZER;
 	data->state_mutex = (pthread_mutex_t)PTHREAD_MUTEX_INITIALIZER;
-	return (SUCCESS);
+	if (pthread_cond_init(&data->start_cond, NULL) != 0)
+		return (FAILURE);
+	return (init_monotonic_cond(&data->stop_cond));
 }
 
 /**
@@ -65,9 +94,13 @@ int	init_data(t_data *data, int argc, char **argv)
  * ┌─────────────────────────────────────────────────┐
  * │ Fork Initialization Process:                    │
  * │                                                 │
- * │ 1. Allocate memory for all forks                │
+ * │ 1. Allocate all forks, one cache line each, so  │
+ * │    neighbouring fork locks never share a line   │
  * │ 2. Initialize each fork's mutex                 │
  * │ 3. Assign unique ID to each fork                │
+ * │ 4. Hygienic mode: fork i starts dirty with the  │
+ * │    lower id of its two users (i, or 1 for fork  │
+ * │    0), so the precedence graph has no cycle     │
  * │                                                 │
  * │ Fork IDs: 0, 1, 2, ..., (num_philosophers-1)    │
  * └─────────────────────────────────────────────────┘
@@ -77,14 +110,20 @@ int	init_forks(t_data *data)
 	int	i;
 
 	i = 0;
-	data->forks = malloc(sizeof(t_fork) * data->num_philosophers);
+	if (data->fork_mode == FORKS_HYGIENIC
+		&& data->engine_mode != ENGINE_THREADS)
+		return (dprintf(data->out_fd,
+				"Error: --forks=hygienic needs --engine=threads\n"), FAILURE);
+	data->forks = arena_alloc(data, sizeof(t_fork) * data->num_philosophers);
 	if (!data->forks)
 		return (FAILURE);
-	memset(data->forks, 0, sizeof(t_fork) * data->num_philosophers);
 	while (i < data->num_philosophers)
 	{
 		data->forks[i].mutex = (pthread_mutex_t)PTHREAD_MUTEX_INITIALIZER;
+		data->forks[i].cond = (pthread_cond_t)PTHREAD_COND_INITIALIZER;
 		data->forks[i].id = i;
+		data->forks[i].owner = i + (i == 0);
+		data->forks[i].dirty = 1;
 		i++;
 	}
 	return (SUCCESS);
@@ -101,11 +140,15 @@ int	init_forks(t_data *data)
  * ┌─────────────────────────────────────────────────┐
  * │ Philosopher Initialization:                     │
  * │                                                 │
- * │ 1. Allocate memory for all philosophers         │
+ * │ 1. Allocate cache-line aligned philosophers and │
+ * │    the shared meal table (init_meals)           │
  * │ 2. For each philosopher i:                      │
  * │    - ID = i+1 (1-indexed for display)           │
  * │    - Left fork = fork[i]                        │
  * │    - Right fork = fork[(i+1) % total]           │
+ * │    - First/second fork resolved once, by id     │
+ * │      parity (setup_forks)                       │
+ * │    - Log suffixes " <id> <status>\n" built once │
  * │                                                 │
  * │ Fork assignment prevents deadlocks by ensuring  │
  * │ all philosophers reach for forks in same order  │
@@ -113,22 +156,26 @@ int	init_forks(t_data *data)
  */
 int	init_philosophers(t_data *data)
 {
-	int	i;
+	t_philo	*philo;
+	int		i;
 
-	data->philosophers = malloc(sizeof(t_philo) * data->num_philosophers);
-	if (!data->philosophers)
+	data->philosophers = arena_alloc(data, sizeof(t_philo)
+			* data->num_philosophers);
+	data->suffixes = arena_alloc(data, LOG_SUFFIX_SIZE * ST_COUNT
+			* (size_t)data->num_philosophers);
+	if (!data->philosophers || !data->suffixes || init_meals(data) == FAILURE)
 		return (FAILURE);
-	memset(data->philosophers, 0, sizeof(t_philo) * data->num_philosophers);
 	i = 0;
 	while (i < data->num_philosophers)
 	{
-		data->philosophers[i].id = i + 1;
-		data->philosophers[i].data = data;
-		data->philosophers[i].left_fork = &data->forks[i];
-		data->philosophers[i].right_fork = &data->forks[(i + 1)
-			% data->num_philosophers];
-		data->philosophers[i].meal_mutex = (pthread_mutex_t)\
-PTHREAD_MUTEX_INITIALIZER;
+		philo = &data->philosophers[i];
+		philo->id = i + 1;
+		philo->data = data;
+		philo->left_fork = &data->forks[i];
+		philo->right_fork = &data->forks[(i + 1) % data->num_philosophers];
+		setup_forks(philo, &philo->first_fork, &philo->second_fork);
+		init_suffixes(philo, data->suffixes
+			+ (size_t)i * ST_COUNT * LOG_SUFFIX_SIZE);
 		i++;
 	}
 	return (SUCCESS);
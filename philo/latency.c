@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   latency.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:24:50 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 08:47:13 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name latency_init
+ * @brief Allocates the instrumentation block when --latency is given
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if disabled or allocated, FAILURE otherwise
+ *
+ * data->latency stays NULL otherwise, and every probe below is then a
+ * single pointer test. --engine=des has no monitor lag nor wall-clock
+ * slack to measure, so the option is refused there.
+ */
+int	latency_init(t_data *data)
+{
+	if (data->near_ms <= 0)
+		return (SUCCESS);
+	if (data->engine_mode == ENGINE_DES)
+		return (dprintf(data->out_fd,
+				"Error: --latency needs real time, not --engine=des\n"),
+			FAILURE);
+	data->latency = arena_alloc(data, sizeof(t_latency));
+	if (!data->latency)
+		return (FAILURE);
+	data->latency->near_us = data->near_ms * 1000LL;
+	return (SUCCESS);
+}
+
+/**
+ * @name latency_lag
+ * @brief Records how late a monitor checks a due deadline
+ *
+ * @param data Pointer to main data structure
+ * @param key Deadline the monitor woke up for, in ms
+ * @param now_us Time of the check
+ *
+ * Checks made before the key is due (the must-eat poll) are not lag and
+ * are left out.
+ */
+void	latency_lag(t_data *data, long long key, long long now_us)
+{
+	if (data->latency && now_us >= key * 1000)
+		hist_add(&data->latency->lag, now_us - key * 1000);
+}
+
+/**
+ * @name latency_meal
+ * @brief Records the slack left when a meal starts
+ *
+ * @param philo Philosopher that just started eating (phase_end set)
+ * @param deadline Its death deadline before this meal, in ms
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │   last meal        meal start       deadline    │
+ * │ ──────┼────────────────┼───────────────┼──────► │
+ * │                        │◄─── slack ───►│        │
+ * │                                                 │
+ * │ slack < near_us: kept as a near miss, with the  │
+ * │ time the "is eating" line went out as print     │
+ * └─────────────────────────────────────────────────┘
+ */
+void	latency_meal(t_philo *philo, long long deadline)
+{
+	t_latency		*lat;
+	t_lat_record	*rec;
+	long long		slack;
+	int				i;
+
+	lat = philo->data->latency;
+	if (!lat)
+		return ;
+	slack = deadline * 1000 - philo->phase_end;
+	hist_add(&lat->slack, slack);
+	if (slack >= lat->near_us)
+		return ;
+	i = atomic_fetch_add_explicit(&lat->near_count, 1, memory_order_relaxed);
+	if (i >= LAT_RECORDS)
+		return ;
+	rec = &lat->near[i];
+	rec->deadline = deadline * 1000;
+	rec->detect = philo->phase_end;
+	rec->print = get_time_us();
+	rec->id = philo->id;
+}
+
+/**
+ * @name latency_death
+ * @brief Records the timings of the reported death
+ *
+ * @param data Pointer to main data structure
+ * @param philo Philosopher that died
+ * @param deadline Its death deadline, in ms
+ * @param detect_us Time the monitor read the clock and found it dead
+ *
+ * Called right after announce_death, so print is taken once the line
+ * has been written (or queued, --log=async).
+ */
+void	latency_death(t_data *data, t_philo *philo, long long deadline,
+		long long detect_us)
+{
+	t_lat_record	*rec;
+
+	if (!data->latency)
+		return ;
+	rec = &data->latency->death;
+	rec->print = get_time_us();
+	rec->deadline = deadline * 1000;
+	rec->detect = detect_us;
+	rec->id = philo->id;
+	data->latency->died = 1;
+}
@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   latency_hist.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:33:12 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/18 19:33:12 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name hist_index
+ * @brief Maps a value to its log-linear bucket
+ *
+ * @param value Sample in µs, negative values count as 0
+ * @return int Bucket index below LAT_BUCKETS
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ 0..31        one bucket per µs                  │
+ * │ 32..63       one bucket per µs                  │
+ * │ 64..127      one bucket per 2 µs                │
+ * │ 2^m..2^(m+1) 32 buckets of 2^(m-5) µs           │
+ * └─────────────────────────────────────────────────┘
+ */
+static int	hist_index(long long value)
+{
+	int	mag;
+	int	index;
+
+	if (value < (1 << LAT_SUB_BITS))
+	{
+		if (value < 0)
+			return (0);
+		return (value);
+	}
+	mag = LAT_SUB_BITS;
+	while ((value >> (mag + 1)) != 0)
+		mag++;
+	index = ((mag - LAT_SUB_BITS + 1) << LAT_SUB_BITS)
+		+ (int)(value >> (mag - LAT_SUB_BITS)) - (1 << LAT_SUB_BITS);
+	if (index >= LAT_BUCKETS)
+		return (LAT_BUCKETS - 1);
+	return (index);
+}
+
+/**
+ * @name hist_value
+ * @brief Lowest value that falls into a bucket
+ *
+ * @param index Bucket index
+ * @return long long Lower bound of the bucket, in µs
+ */
+static long long	hist_value(int index)
+{
+	int	mag;
+
+	if (index < (1 << LAT_SUB_BITS))
+		return (index);
+	mag = (index >> LAT_SUB_BITS) + LAT_SUB_BITS - 1;
+	return ((long long)((1 << LAT_SUB_BITS) + (index & ((1 << LAT_SUB_BITS)
+					- 1))) << (mag - LAT_SUB_BITS));
+}
+
+/**
+ * @name hist_add
+ * @brief Counts one sample
+ *
+ * @param hist Histogram, possibly shared between threads
+ * @param value Sample in µs
+ */
+void	hist_add(t_hist *hist, long long value)
+{
+	long long	max;
+
+	atomic_fetch_add_explicit(&hist->counts[hist_index(value)], 1,
+		memory_order_relaxed);
+	atomic_fetch_add_explicit(&hist->total, 1, memory_order_relaxed);
+	max = atomic_load_explicit(&hist->max, memory_order_relaxed);
+	while (value > max && !atomic_compare_exchange_weak_explicit(&hist->max,
+			&max, value, memory_order_relaxed, memory_order_relaxed))
+		;
+}
+
+/**
+ * @name hist_percentiles
+ * @brief Prints the usual percentiles of a histogram
+ *
+ * @param hist Histogram to read
+ * @param total Number of samples in it
+ *
+ * Each percentile is reported as the upper bound of the bucket it falls
+ * in, capped by the exact maximum.
+ */
+static void	hist_percentiles(t_hist *hist, long long total)
+{
+	static const int	per_mille[] = {500, 900, 990, 999, 1000};
+	long long			seen;
+	long long			upper;
+	int					i;
+	int					p;
+
+	seen = 0;
+	i = 0;
+	p = 0;
+	while (i < LAT_BUCKETS && p < 5)
+	{
+		seen += atomic_load_explicit(&hist->counts[i], memory_order_relaxed);
+		while (p < 5 && seen * 1000 >= total * per_mille[p])
+		{
+			upper = hist_value(i + 1) - 1;
+			if (upper > hist->max)
+				upper = hist->max;
+			fprintf(stderr, "  p%-5.1f %10lld us\n", per_mille[p] / 10.0,
+				upper);
+			p++;
+		}
+		i++;
+	}
+}
+
+/**
+ * @name hist_print
+ * @brief Prints a histogram to stderr: percentiles, then every
+ *        non-empty bucket with its cumulative share
+ *
+ * @param title What the samples measure
+ * @param hist Histogram to print
+ */
+void	hist_print(char *title, t_hist *hist)
+{
+	long long	total;
+	long long	seen;
+	long long	count;
+	int			i;
+
+	total = atomic_load_explicit(&hist->total, memory_order_relaxed);
+	fprintf(stderr, "%s: %lld samples\n", title, total);
+	if (total == 0)
+		return ;
+	hist_percentiles(hist, total);
+	fprintf(stderr, "  %12s %12s %10s %8s\n", "from_us", "to_us", "count",
+		"cum%");
+	seen = 0;
+	i = 0;
+	while (i < LAT_BUCKETS)
+	{
+		count = atomic_load_explicit(&hist->counts[i], memory_order_relaxed);
+		seen += count;
+		if (count)
+			fprintf(stderr, "  %12lld %12lld %10lld %7.3f%%\n", hist_value(i),
+				hist_value(i + 1) - 1, count, 100.0 * seen / total);
+		i++;
+	}
+}
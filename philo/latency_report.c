@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   latency_report.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:41:27 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/18 19:52:06 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name print_record
+ * @brief Prints one death or near miss relative to the simulation start
+ *
+ * @param what "death" or "near miss"
+ * @param event Name of rec->detect: the monitor's check for a death, the
+ *              meal start for a near miss
+ * @param rec Timings to print
+ * @param start Simulation start in µs
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ death: philo 3 deadline 310.000 ms              │
+ * │        detected +61 us printed +74 us           │
+ * │ near miss: philo 2 deadline 610.000 ms          │
+ * │        ate -9006 us printed -9005 us            │
+ * └─────────────────────────────────────────────────┘
+ */
+static void	print_record(char *what, char *event, t_lat_record *rec,
+		long long start)
+{
+	fprintf(stderr, "%s: philo %d deadline %lld.%03lld ms %s %+lld us "
+		"printed %+lld us\n", what, rec->id, (rec->deadline - start) / 1000,
+		(rec->deadline - start) % 1000, event, rec->detect - rec->deadline,
+		rec->print - rec->deadline);
+}
+
+/**
+ * @name latency_report
+ * @brief Prints the --latency report to stderr once all threads are done
+ *
+ * @param data Pointer to main data structure
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ monitor lag histogram (deadline → check)        │
+ * │ slack histogram (meal start → deadline)         │
+ * │ near misses: count, then up to LAT_RECORDS      │
+ * │ death timings, if anybody died                  │
+ * └─────────────────────────────────────────────────┘
+ */
+void	latency_report(t_data *data)
+{
+	t_latency	*lat;
+	long long	start;
+	int			count;
+	int			i;
+
+	lat = data->latency;
+	if (!lat)
+		return ;
+	start = data->start_time * 1000;
+	hist_print("monitor lag, deadline to check (us)", &lat->lag);
+	hist_print("slack at meal start (us)", &lat->slack);
+	count = atomic_load_explicit(&lat->near_count, memory_order_relaxed);
+	fprintf(stderr, "near misses (slack < %lld ms): %d\n",
+		lat->near_us / 1000, count);
+	i = 0;
+	while (i < count && i < LAT_RECORDS)
+	{
+		print_record("near miss", "ate", &lat->near[i], start);
+		i++;
+	}
+	if (lat->died)
+		print_record("death", "detected", &lat->death, start);
+}
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log_async.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:58:21 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 06:55:12 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name log_init
+ * @brief Allocates one event ring per philosopher plus one for the monitor
+ *
+ * @param data Pointer to the main data structure
+ * @return int SUCCESS if allocation succeeded (or logging is sync)
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ Ring Layout (N philosophers):                   │
+ * │                                                 │
+ * │ rings[0 .. N-1] → philosopher id - 1            │
+ * │ rings[N]        → monitor (death event only)    │
+ * │                                                 │
+ * │ Rings, slots and the writer's batch buffer all  │
+ * │ come from the arena                             │
+ * │ The writer's output (stdout, or the --trace     │
+ * │ file) was chosen by trace_open                  │
+ * └─────────────────────────────────────────────────┘
+ */
+int	log_init(t_data *data)
+{
+	t_log		*log;
+	t_event		*slots;
+	int			i;
+
+	log = &data->log;
+	if (data->log_mode != LOG_ASYNC)
+		return (SUCCESS);
+	log->philos = data->philosophers;
+	log->ring_count = data->num_philosophers + 1;
+	log->rings = arena_alloc(data, sizeof(t_ring) * log->ring_count);
+	log->buf = arena_alloc(data, LOG_BUF_SIZE);
+	slots = arena_alloc(data, sizeof(t_event) * LOG_RING_SIZE
+			* log->ring_count);
+	if (!log->rings || !log->buf || !slots)
+		return (FAILURE);
+	i = 0;
+	while (i < log->ring_count)
+	{
+		log->rings[i].slots = slots + (size_t)i * LOG_RING_SIZE;
+		i++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @name log_push
+ * @brief Appends an event to a ring, waiting only if the ring is full
+ *
+ * @param ring Ring owned by the calling thread
+ * @param event Event to publish
+ */
+void	log_push(t_ring *ring, t_event event)
+{
+	unsigned int	tail;
+
+	tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+	while (tail - atomic_load_explicit(&ring->head, memory_order_acquire)
+		>= LOG_RING_SIZE)
+		usleep(100);
+	ring->slots[tail & (LOG_RING_SIZE - 1)] = event;
+	atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+}
+
+/**
+ * @name log_writer
+ * @brief Writer thread: drains all rings every millisecond
+ *
+ * @param arg Void pointer to main data structure
+ * @return void* NULL
+ *
+ * Only events at least LOG_HOLD_MS old are written, so an event stamped
+ * just before a peer's has time to land in its ring first. Once the
+ * simulation threads are joined everything left is flushed.
+ */
+static void	*log_writer(void *arg)
+{
+	t_data	*data;
+
+	data = (t_data *)arg;
+	while (!atomic_load_explicit(&data->log.finished, memory_order_acquire))
+	{
+		usleep(1000);
+		log_flush(&data->log, get_time() - data->start_time - LOG_HOLD_MS);
+	}
+	log_flush(&data->log, LLONG_MAX);
+	return (NULL);
+}
+
+/**
+ * @name log_start
+ * @brief Launches the writer thread when asynchronous logging is enabled
+ *
+ * @param data Pointer to the main data structure
+ * @return int SUCCESS if the thread was created (or logging is sync)
+ */
+int	log_start(t_data *data)
+{
+	if (data->log_mode != LOG_ASYNC)
+		return (SUCCESS);
+	if (pthread_create(&data->log.writer, &data->thread_attr, log_writer,
+			data) != 0)
+		return (FAILURE);
+	data->log.started = 1;
+	return (SUCCESS);
+}
+
+/**
+ * @name log_finish
+ * @brief Tells the writer that no more events will arrive and joins it
+ *
+ * @param data Pointer to the main data structure
+ */
+void	log_finish(t_data *data)
+{
+	if (!data->log.started)
+		return ;
+	atomic_store_explicit(&data->log.finished, 1, memory_order_release);
+	pthread_join(data->log.writer, NULL);
+}
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log_format.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:20:48 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/18 11:20:48 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name digit_pairs
+ * @brief Returns the "00" to "99" lookup table used by format_number
+ *
+ * @return const char* 200 characters, pair k at offset 2 * k
+ */
+static const char	*digit_pairs(void)
+{
+	return ("00010203040506070809"
+		"10111213141516171819"
+		"20212223242526272829"
+		"30313233343536373839"
+		"40414243444546474849"
+		"50515253545556575859"
+		"60616263646566676869"
+		"70717273747576777879"
+		"80818283848586878889"
+		"90919293949596979899");
+}
+
+/**
+ * @name count_digits
+ * @brief Number of decimal digits needed for a non-negative number
+ *
+ * @param n Number to measure
+ * @return int Digit count, at least 1
+ */
+static int	count_digits(long long n)
+{
+	int	len;
+
+	len = 1;
+	while (n >= 10000)
+	{
+		n /= 10000;
+		len += 4;
+	}
+	while (n >= 10)
+	{
+		n /= 10;
+		len++;
+	}
+	return (len);
+}
+
+/**
+ * @name format_number
+ * @brief Writes a non-negative number in decimal, two digits per step
+ *
+ * @param dst Destination buffer (no terminator is added)
+ * @param n Number to convert
+ * @return int Number of characters written
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ n = 12345, len = 5                              │
+ * │                                                 │
+ * │ 45 → dst[3..4]   23 → dst[1..2]   1 → dst[0]    │
+ * │                                                 │
+ * │ No locale, no format string, one division per   │
+ * │ two digits                                      │
+ * └─────────────────────────────────────────────────┘
+ */
+int	format_number(char *dst, long long n)
+{
+	const char	*pairs;
+	int			len;
+	int			pos;
+
+	pairs = digit_pairs();
+	len = count_digits(n);
+	pos = len;
+	while (n >= 100)
+	{
+		pos -= 2;
+		dst[pos] = pairs[(n % 100) * 2];
+		dst[pos + 1] = pairs[(n % 100) * 2 + 1];
+		n /= 100;
+	}
+	if (n >= 10)
+	{
+		dst[0] = pairs[n * 2];
+		dst[1] = pairs[n * 2 + 1];
+	}
+	else
+		dst[0] = '0' + n;
+	return (len);
+}
+
+/**
+ * @name init_suffixes
+ * @brief Precomputes " <id> <status>\n" for every state of a philosopher
+ *
+ * @param philo Philosopher whose id is used
+ * @param block LOG_SUFFIX_SIZE bytes per state, owned by data->suffixes
+ */
+void	init_suffixes(t_philo *philo, char *block)
+{
+	char	*dst;
+	int		state;
+
+	philo->suffix = block;
+	state = 0;
+	while (state < ST_COUNT)
+	{
+		dst = block + state * LOG_SUFFIX_SIZE;
+		dst += ft_putstr_buf(dst, " ");
+		dst += format_number(dst, philo->id);
+		dst += ft_putstr_buf(dst, " ");
+		dst += ft_putstr_buf(dst, status_string(state));
+		dst += ft_putstr_buf(dst, "\n");
+		philo->suffix_len[state] = dst - (block + state * LOG_SUFFIX_SIZE);
+		state++;
+	}
+}
+
+/**
+ * @name format_line
+ * @brief Builds a complete log line from a timestamp and a suffix
+ *
+ * @param dst Destination buffer, at least LOG_LINE_SIZE bytes
+ * @param philo Philosopher the line is about
+ * @param ts Timestamp in milliseconds since simulation start
+ * @param state State to report
+ * @return int Line length, ready for a single write
+ */
+int	format_line(char *dst, t_philo *philo, long long ts, t_state state)
+{
+	int	len;
+
+	len = format_number(dst, ts);
+	memcpy(dst + len, philo->suffix + state * LOG_SUFFIX_SIZE,
+		philo->suffix_len[state]);
+	return (len + philo->suffix_len[state]);
+}
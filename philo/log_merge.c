@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log_merge.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:14:52 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 06:01:26 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name buf_flush
+ * @brief Writes the pending batch in as few calls as possible
+ *
+ * @param log Pointer to the log state
+ */
+static void	buf_flush(t_log *log)
+{
+	ssize_t	done;
+	int		off;
+
+	off = 0;
+	while (off < log->len)
+	{
+		done = write(log->fd, log->buf + off, log->len - off);
+		if (done <= 0)
+			break ;
+		off += done;
+	}
+	log->len = 0;
+}
+
+/**
+ * @name buf_event
+ * @brief Appends "timestamp id status\n" (or a trace record) to the batch
+ *
+ * @param log Pointer to the log state
+ * @param ev Event to format
+ *
+ * Nothing is written once the death line has gone out.
+ */
+static void	buf_event(t_log *log, t_event *ev)
+{
+	if (log->closed)
+		return ;
+	if (log->len + LOG_LINE_SIZE > LOG_BUF_SIZE)
+		buf_flush(log);
+	if (log->trace)
+		log->len += trace_record(log->buf + log->len, &log->last_ts, ev);
+	else
+		log->len += format_line(log->buf + log->len,
+				&log->philos[ev->id - 1], ev->ts, ev->state);
+	atomic_fetch_add_explicit(&log->lines, 1, memory_order_relaxed);
+	if (ev->state == ST_DIED)
+		log->closed = 1;
+}
+
+/**
+ * @name drain_ring
+ * @brief Emits the events of one ring stamped at or before cur
+ *
+ * @param log Pointer to the log state
+ * @param ring Ring to drain
+ * @param cur Timestamp bound for this pass
+ * @return long long Timestamp of the new head, LLONG_MAX if ring is empty
+ */
+static long long	drain_ring(t_log *log, t_ring *ring, long long cur)
+{
+	unsigned int	head;
+	unsigned int	tail;
+	t_event			*ev;
+
+	head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+	tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+	while (head != tail)
+	{
+		ev = &ring->slots[head & (LOG_RING_SIZE - 1)];
+		if (ev->ts > cur)
+			break ;
+		buf_event(log, ev);
+		head++;
+	}
+	atomic_store_explicit(&ring->head, head, memory_order_release);
+	if (head == tail)
+		return (LLONG_MAX);
+	return (ring->slots[head & (LOG_RING_SIZE - 1)].ts);
+}
+
+/**
+ * @name emit_until
+ * @brief Emits every ring head stamped at or before cur
+ *
+ * @param log Pointer to the log state
+ * @param cur Timestamp bound for this pass
+ * @return long long Oldest timestamp still pending, LLONG_MAX if none
+ *
+ * Rings are visited in index order, so the monitor ring (last) puts a
+ * death after any same-millisecond line of the philosophers.
+ */
+static long long	emit_until(t_log *log, long long cur)
+{
+	long long	next;
+	long long	head_ts;
+	int			i;
+
+	next = LLONG_MAX;
+	i = 0;
+	while (i < log->ring_count)
+	{
+		head_ts = drain_ring(log, &log->rings[i], cur);
+		if (head_ts < next)
+			next = head_ts;
+		i++;
+	}
+	return (next);
+}
+
+/**
+ * @name log_flush
+ * @brief Merges all rings in timestamp order up to a watermark
+ *
+ * @param log Pointer to the log state
+ * @param watermark Newest timestamp that is safe to write
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ ring 0: 200 400      ring 1: 200 201            │
+ * │                                                 │
+ * │ pass cur=-1  → finds oldest head: 200           │
+ * │ pass cur=200 → emits 0:200, 1:200; next 201     │
+ * │ pass cur=201 → emits 1:201; next 400            │
+ * │ 400 > watermark → stop, rest waits a round      │
+ * └─────────────────────────────────────────────────┘
+ */
+void	log_flush(t_log *log, long long watermark)
+{
+	long long	cur;
+
+	cur = emit_until(log, -1);
+	while (cur != LLONG_MAX && cur <= watermark)
+		cur = emit_until(log, cur);
+	buf_flush(log);
+}
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log_status.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:27:33 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 06:55:12 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name status_string
+ * @brief Returns the log text for a philosopher state
+ *
+ * @param state State to describe
+ * @return const char* Text printed after the philosopher id
+ */
+const char	*status_string(t_state state)
+{
+	if (state == ST_FORK)
+		return ("has taken a fork");
+	if (state == ST_EAT)
+		return ("is eating");
+	if (state == ST_SLEEP)
+		return ("is sleeping");
+	if (state == ST_THINK)
+		return ("is thinking");
+	return ("died");
+}
+
+/**
+ * @name log_status
+ * @brief Queues a status line in the philosopher's own ring
+ *
+ * @param philo Pointer to philosopher structure
+ * @param state State to log
+ *
+ * The timestamp is taken before the stop check: once the monitor has
+ * stamped a death under state_mutex, every event that passes the check
+ * is guaranteed to be stamped no later than the death itself.
+ */
+void	log_status(t_philo *philo, t_state state)
+{
+	t_event	event;
+
+	event.ts = get_time() - philo->data->start_time;
+	if (check_simulation_stop(philo))
+		return ;
+	event.id = philo->id;
+	event.state = state;
+	log_push(&philo->data->log.rings[philo->id - 1], event);
+}
+
+/**
+ * @name announce_async
+ * @brief Async half of announce_death: stop, stamp, queue the line
+ *
+ * @param data Pointer to main data structure
+ * @param philo Philosopher that starved
+ * @return int 1 if the death was queued, 0 if the simulation had stopped
+ *
+ * The monitor ring has a single producer: only the caller that finds
+ * the stop flag clear pushes to it, and records itself in data->died.
+ */
+static int	announce_async(t_data *data, t_philo *philo)
+{
+	t_event	event;
+	int		stopped;
+
+	pthread_mutex_lock(&data->state_mutex);
+	stopped = data->simulation_stop;
+	if (!stopped)
+		data->died = philo->id;
+	set_simulation_stop(data);
+	event.ts = get_time() - data->start_time;
+	pthread_mutex_unlock(&data->state_mutex);
+	if (stopped)
+		return (0);
+	event.id = philo->id;
+	event.state = ST_DIED;
+	log_push(&data->log.rings[data->num_philosophers], event);
+	return (1);
+}
+
+/**
+ * @name announce_death
+ * @brief Stops the simulation and reports the philosopher that died
+ *
+ * @param data Pointer to main data structure
+ * @param philo Philosopher that starved
+ * @return int 1 if this call reported the death, 0 if the simulation
+ *             had already stopped
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ sync:  print + state locked, stop, write line   │
+ * │ async: state locked, stop, stamp; the death is  │
+ * │        queued in the monitor ring and the       │
+ * │        writer closes the log after it           │
+ * │                                                 │
+ * │ With several monitor shards only the first      │
+ * │ death to find the flag clear is reported        │
+ * └─────────────────────────────────────────────────┘
+ */
+int	announce_death(t_data *data, t_philo *philo)
+{
+	int	len;
+	int	reported;
+
+	if (data->log_mode == LOG_ASYNC)
+		return (announce_async(data, philo));
+	pthread_mutex_lock(&data->print_mutex);
+	pthread_mutex_lock(&data->state_mutex);
+	reported = !data->simulation_stop;
+	if (reported)
+		data->died = philo->id;
+	if (reported && data->log_mode == LOG_SYNC)
+	{
+		len = format_line(data->line, philo, get_time() - data->start_time,
+				ST_DIED);
+		write(data->out_fd, data->line, len);
+		atomic_fetch_add_explicit(&data->log.lines, 1, memory_order_relaxed);
+	}
+	set_simulation_stop(data);
+	pthread_mutex_unlock(&data->state_mutex);
+	pthread_mutex_unlock(&data->print_mutex);
+	return (reported);
+}
+
+/**
+ * @name log_close
+ * @brief Closes the --trace file and forgets the log's arena blocks
+ *
+ * @param data Pointer to the main data structure
+ *
+ * The rings and the writer batch buffer go with the arena; only the
+ * trace file descriptor is the log's own to release.
+ */
+void	log_close(t_data *data)
+{
+	data->log.rings = NULL;
+	data->log.buf = NULL;
+	if (data->trace_fd >= 0)
+		close(data->trace_fd);
+	data->trace_fd = -1;
+}
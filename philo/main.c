@@ -6,7 +6,7 @@
 /*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/05 17:25:34 by mkurkar           #+#    #+#             */
-/*   Updated: 2025/06/08 20:34:21 by mkurkar          ###   ########.fr       */
+/*   Updated: 2026/10/19 06:24:50 by mkurkar          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,33 +14,32 @@
 
 /**
  * @name wait_for_all_threads
- * @brief Makes the philosopher thread wait until all threads are ready
+ * @brief Blocks the calling thread until the start gate opens
  *
- * @param philo Pointer to philosopher structure
+ * @param data Pointer to main data structure
  *
  * Example:
  * ┌─────────────────────────────────────────────────┐
- * │ Wait Mechanism:                                 │
+ * │ Start Gate:                                     │
  * │                                                 │
  * │ 1. Lock state mutex                             │
- * │ 2. Check if all threads are ready               │
- * │ 3. If not, unlock and briefly sleep             │
- * │ 4. Reacquire lock and check again               │
- * │ 5. Once all threads are ready, continue         │
+ * │ 2. While all_threads_ready is 0, wait on        │
+ * │    start_cond (the mutex is released meanwhile) │
+ * │ 3. open_start_gate sets the flag and broadcasts │
+ * │    once: every philosopher and monitor wakes    │
+ * │ 4. Unlock and start                             │
  * │                                                 │
- * │ This ensures philosophers start simultaneously  │
+ * │ Waiting threads are parked in the kernel, so    │
+ * │ thousands of them no longer poll the mutex      │
+ * │ every 100 µs while the rest are being created   │
  * └─────────────────────────────────────────────────┘
  */
-void	wait_for_all_threads(t_philo *philo)
+void	wait_for_all_threads(t_data *data)
 {
-	pthread_mutex_lock(&philo->data->state_mutex);
-	while (!philo->data->all_threads_ready)
-	{
-		pthread_mutex_unlock(&philo->data->state_mutex);
-		usleep(100);
-		pthread_mutex_lock(&philo->data->state_mutex);
-	}
-	pthread_mutex_unlock(&philo->data->state_mutex);
+	pthread_mutex_lock(&data->state_mutex);
+	while (!data->all_threads_ready)
+		pthread_cond_wait(&data->start_cond, &data->state_mutex);
+	pthread_mutex_unlock(&data->state_mutex);
 }
 
 /* Thread creation */
@@ -57,9 +56,9 @@ void	wait_for_all_threads(t_philo *philo)
  * │                                                 │
  * │ 1. Iterate through all philosophers             │
  * │ 2. For each philosopher:                        │
- * │    a. Lock their meal mutex                     │
- * │    b. Set last_meal_time to simulation start    │
- * │    c. Unlock mutex                              │
+ * │    a. Store simulation start as last_meal_time  │
+ * │    b. No lock needed: threads are not running   │
+ * │       yet and the store is atomic               │
  * │                                                 │
  * │ This ensures all philosophers start with a      │
  * │ synchronized last meal time value               │
@@ -72,54 +71,44 @@ static int	init_meal_times(t_data *data)
 	i = 0;
 	while (i < data->num_philosophers)
 	{
-		pthread_mutex_lock(&data->philosophers[i].meal_mutex);
-		data->philosophers[i].last_meal_time = data->start_time;
-		pthread_mutex_unlock(&data->philosophers[i].meal_mutex);
+		atomic_store_explicit(&data->meals.last_meal_time[i],
+			data->start_time, memory_order_relaxed);
 		i++;
 	}
 	return (SUCCESS);
 }
 
 /**
- * @name init_philo_threads
- * @brief Creates threads for all philosophers and the monitor
+ * @name open_start_gate
+ * @brief Starts the clock and releases every waiting thread at once
  *
  * @param data Pointer to main data structure
- * @param monitor Pointer to monitor thread identifier
- * @return int SUCCESS if all threads created, FAILURE otherwise
+ * @return int SUCCESS if the log writer started, FAILURE otherwise
  *
  * Example:
  * ┌─────────────────────────────────────────────────┐
- * │ Thread Creation Process:                        │
+ * │ Gate Opening:                                   │
  * │                                                 │
- * │ 1. For each philosopher:                        │
- * │    a. Create thread with philosopher_routine    │
- * │    b. Pass philosopher's data as argument       │
- * │    c. If creation fails, return FAILURE         │
- * │                                                 │
- * │ 2. Create monitor thread                        │
- * │    a. Run monitor_routine                       │
- * │    b. Pass main data structure as argument      │
- * │    c. If creation fails, return FAILURE         │
- * │                                                 │
- * │ No threads start their main work until all      │
- * │ threads have been created successfully          │
+ * │ 1. Record simulation start time, now that the   │
+ * │    threads exist, so timestamps start near 0    │
+ * │    however long creating them took              │
+ * │ 2. Initialize meal times for all philosophers   │
+ * │ 3. Start the async log writer (--log=async)     │
+ * │ 4. Set all_threads_ready and broadcast          │
+ * │    start_cond under the state mutex             │
+ * │ 5. Mark the --shm table as running              │
  * └─────────────────────────────────────────────────┘
  */
-static int	init_philo_threads(t_data *data, pthread_t *monitor)
+static int	open_start_gate(t_data *data)
 {
-	int	i;
-
-	i = 0;
-	while (i < data->num_philosophers)
-	{
-		if (pthread_create(&data->philosophers[i].thread, NULL,
-				philosopher_routine, &data->philosophers[i]) != 0)
-			return (FAILURE);
-		i++;
-	}
-	if (pthread_create(monitor, NULL, monitor_routine, data) != 0)
+	data->start_time = get_time();
+	if (init_meal_times(data) == FAILURE || log_start(data) == FAILURE)
 		return (FAILURE);
+	pthread_mutex_lock(&data->state_mutex);
+	data->all_threads_ready = 1;
+	pthread_cond_broadcast(&data->start_cond);
+	pthread_mutex_unlock(&data->state_mutex);
+	shm_phase(data, SHM_RUNNING, 0);
 	return (SUCCESS);
 }
 
@@ -134,14 +123,20 @@ static int	init_philo_threads(t_data *data, pthread_t *monitor)
  * ┌─────────────────────────────────────────────────┐
  * │ Thread Creation and Management Flow:            │
  * │                                                 │
- * │ 1. Record simulation start time                 │
- * │ 2. Initialize meal times for all philosophers   │
- * │ 3. Create philosopher threads and monitor thread │
- * │ 4. Set the all_threads_ready flag to 1          │
- * │    (this releases waiting threads)              │
+ * │ 1. Create philosopher threads (threads engine   │
+ * │    only, in parallel for large N), monitors     │
+ * │    and, with --metrics, the metrics thread      │
+ * │ 2. Open the start gate: start time, meal times, │
+ * │    log writer, then one broadcast releases all  │
+ * │ 3. --engine=coro: start the worker threads      │
  * │                                                 │
- * │ 5. Wait for all philosopher threads to complete │
- * │ 6. Wait for monitor thread to complete          │
+ * │ 4. Wait for all philosopher threads (or the     │
+ * │    workers) to complete                         │
+ * │ 5. Wait for the monitors, then drain the log    │
+ * │    and write the final metrics record           │
+ * │                                                 │
+ * │ If any thread cannot be created, abort_threads  │
+ * │ stops the run and joins those that were         │
  * │                                                 │
  * │ This function manages the full lifecycle of     │
  * │ threads from creation to termination            │
@@ -149,27 +144,16 @@ static int	init_philo_threads(t_data *data, pthread_t *monitor)
  */
 int	create_threads(t_data *data)
 {
-	int			i;
-	pthread_t	monitor;
-
-	i = 0;
-	data->start_time = get_time();
-	if (init_meal_times(data) == FAILURE)
-		return (FAILURE);
-	if (init_philo_threads(data, &monitor) == FAILURE)
-		return (FAILURE);
-	pthread_mutex_lock(&data->state_mutex);
-	data->all_threads_ready = 1;
-	pthread_mutex_unlock(&data->state_mutex);
-	while (i < data->num_philosophers)
-	{
-		if (pthread_join(data->philosophers[i].thread, NULL) != 0)
-			return (FAILURE);
-		i++;
-	}
-	if (pthread_join(monitor, NULL) != 0)
+	if ((data->engine_mode == ENGINE_THREADS
+			&& spawn_philosophers(data) == FAILURE)
+		|| start_monitors(data) == FAILURE || metrics_start(data) == FAILURE
+		|| open_start_gate(data) == FAILURE || coro_start(data) == FAILURE)
+		return (abort_threads(data));
+	if (coro_join(data) == FAILURE || join_philosophers(data) == FAILURE
+		|| join_monitors(data) == FAILURE)
 		return (FAILURE);
-	return (SUCCESS);
+	log_finish(data);
+	return (metrics_join(data));
 }
 
 /**
@@ -184,17 +168,31 @@ int	create_threads(t_data *data)
  * ┌────────────────────────────────────────────────────┐
  * │ Program Execution Flow:                            │
  * │                                                    │
- * │ 1. Initialize data structure with zeros            │
- * │ 2. Parse and validate command-line arguments       │
- * │ 3. Initialize forks (mutexes)                      │
- * │ 4. Initialize philosopher structures               │
- * │ 5. Create and manage threads                       │
- * │ 6. Clean up resources                              │
+ * │ 1. --batch=FILE first: run every scenario of FILE  │
+ * │    in this process instead (see batch_main)        │
+ * │ 2. Initialize data structure with zeros, output    │
+ * │    to stdout                                       │
+ * │ 3. run_simulation: strip "--" options, parse and   │
+ * │    validate the positional arguments, build the    │
+ * │    arena, forks, philosophers, log rings, live     │
+ * │    state table, monitor shards and coroutine       │
+ * │    engine, run the engine, clean up                │
  * │                                                    │
  * │ Program Arguments:                                 │
  * │ ./philo number_of_philosophers time_to_die         │
  * │        time_to_eat time_to_sleep                   │
  * │        [number_of_times_each_philosopher_must_eat] │
+ * │        [--log=sync|async|none] [--shm=NAME]        │
+ * │        [--engine=threads|coro|des] [--workers=N]   │
+ * │        [--until=MS] [--monitors=N] [--latency=MS]  │
+ * │        [--forks=ordered|hygienic] [--stack=KB]     │
+ * │        [--pin=none|rr|packed] [--monitor-cpu=N]    │
+ * │        [--monitor-sched=other|fifo] [--trace=FILE] │
+ * │        [--huge=off|thp|on] [--think=adaptive|fixed]│
+ * │        [--fork-lock=mutex|spin|fifo] [--lock-stats]│
+ * │        [--metrics=MS] [--metrics-fd=N]             │
+ * │        [--metrics-format=line|json]                │
+ * │ ./philo --batch=FILE [--jobs=N] [--out=DIR]        │
  * │                                                    │
  * │ Example: ./philo 5 800 200 200 7                   │
  * └────────────────────────────────────────────────────┘
@@ -204,25 +202,9 @@ int	main(int argc, char **argv)
 {
 	t_data	data;
 
+	if (argc > 1 && option_value(argv[1], "--batch"))
+		return (batch_main(argc, argv));
 	memset(&data, 0, sizeof(t_data));
-	if (init_data(&data, argc, argv) == FAILURE)
-		return (1);
-	if (init_forks(&data) == FAILURE)
-	{
-		free_data(&data);
-		return (1);
-	}
-	if (init_philosophers(&data) == FAILURE)
-	{
-		free_data(&data);
-		return (1);
-	}
-	if (create_threads(&data) == FAILURE)
-	{
-		printf("Error creating threads\n");
-		free_data(&data);
-		return (1);
-	}
-	free_data(&data);
-	return (0);
+	data.out_fd = STDOUT_FILENO;
+	return (run_simulation(&data, argc, argv));
 }
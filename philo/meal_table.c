@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   meal_table.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:52:19 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 03:02:37 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name line_round
+ * @brief Rounds a size up to a whole number of cache lines
+ *
+ * @param size Size in bytes
+ * @return size_t Smallest multiple of CACHE_LINE that is >= size
+ */
+size_t	line_round(size_t size)
+{
+	return ((size + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE);
+}
+
+/**
+ * @name init_meals
+ * @brief Allocates the monitor-scanned meal table and wires philosophers
+ *        to their entries
+ *
+ * @param data Pointer to main data structure, philosophers allocated
+ * @return int SUCCESS if allocation succeeded, FAILURE otherwise
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ One block, each array starting on a new line:   │
+ * │                                                 │
+ * │ [last_meal_time × N][eating × N][meals × N]     │
+ * │                                                 │
+ * │ The block comes from the arena;                 │
+ * │ meals_left counts philosophers not yet fed      │
+ * └─────────────────────────────────────────────────┘
+ */
+int	init_meals(t_data *data)
+{
+	size_t	times;
+	size_t	flags;
+	char	*block;
+	int		i;
+
+	times = line_round(sizeof(atomic_llong) * data->num_philosophers);
+	flags = line_round(sizeof(atomic_int) * data->num_philosophers);
+	block = arena_alloc(data, times + 2 * flags);
+	if (!block)
+		return (FAILURE);
+	data->meals.last_meal_time = (atomic_llong *)block;
+	data->meals.eating = (atomic_int *)(block + times);
+	data->meals.meals_eaten = (atomic_int *)(block + times + flags);
+	atomic_init(&data->meals_left, data->num_philosophers);
+	i = 0;
+	while (i < data->num_philosophers)
+	{
+		data->philosophers[i].last_meal_time = &data->meals.last_meal_time[i];
+		data->philosophers[i].eating = &data->meals.eating[i];
+		data->philosophers[i].meals_eaten = &data->meals.meals_eaten[i];
+		i++;
+	}
+	return (SUCCESS);
+}
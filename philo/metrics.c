@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   metrics.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:55:41 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 06:24:50 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name metrics_wait
+ * @brief Sleeps on the stop condition until the next record is due
+ *
+ * @param data Pointer to the main data structure
+ * @param deadline Wall time of the next record (us)
+ * @return int SUCCESS when the deadline is reached, FAILURE on stop
+ */
+static int	metrics_wait(t_data *data, long long deadline)
+{
+	struct timespec	abs;
+	int				stop;
+
+	abs.tv_sec = deadline / 1000000;
+	abs.tv_nsec = (deadline % 1000000) * 1000;
+	pthread_mutex_lock(&data->state_mutex);
+	while (!data->simulation_stop && get_time_us() < deadline)
+		pthread_cond_timedwait(&data->stop_cond, &data->state_mutex, &abs);
+	stop = data->simulation_stop;
+	pthread_mutex_unlock(&data->state_mutex);
+	if (stop)
+		return (FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @name metrics_routine
+ * @brief Writes one record every interval until the run stops
+ *
+ * @param arg Void pointer to the main data structure
+ * @return void* Always NULL
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ gate ──┬── MS ──┬── MS ──┬── MS ─ stop          │
+ * │        │        ↓        ↓          ↓           │
+ * │        │     record   record    joined, then    │
+ * │        │                        final record    │
+ * │        └─ last_us: meal rates are per interval  │
+ * └─────────────────────────────────────────────────┘
+ */
+static void	*metrics_routine(void *arg)
+{
+	t_data		*data;
+	long long	next;
+
+	data = arg;
+	wait_for_all_threads(data);
+	data->metrics.last_us = get_time_us();
+	next = data->metrics.last_us + data->metrics.interval_ms * 1000LL;
+	while (metrics_wait(data, next) == SUCCESS)
+	{
+		metrics_emit(data);
+		next += data->metrics.interval_ms * 1000LL;
+	}
+	return (NULL);
+}
+
+/**
+ * @name metrics_start
+ * @brief Starts the metrics thread when --metrics is given
+ *
+ * @param data Pointer to the main data structure
+ * @return int SUCCESS if metrics are off or the thread runs
+ */
+int	metrics_start(t_data *data)
+{
+	if (data->metrics.interval_ms <= 0)
+		return (SUCCESS);
+	if (pthread_create(&data->metrics.thread, &data->thread_attr,
+			metrics_routine, data) != 0)
+		return (FAILURE);
+	data->metrics.started = 1;
+	return (SUCCESS);
+}
+
+/**
+ * @name metrics_join
+ * @brief Joins the metrics thread and writes the final record
+ *
+ * @param data Pointer to the main data structure, log writer joined
+ * @return int SUCCESS if the thread was never started or was joined
+ *
+ * The final record comes after log_finish so its line count covers
+ * everything the run printed, the death line included, and its meal
+ * rate is the average over the whole run.
+ */
+int	metrics_join(t_data *data)
+{
+	if (!data->metrics.started)
+		return (SUCCESS);
+	if (pthread_join(data->metrics.thread, NULL) != 0)
+		return (FAILURE);
+	data->metrics.last_meals = 0;
+	data->metrics.last_us = data->start_time * 1000;
+	metrics_emit(data);
+	return (SUCCESS);
+}
@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   metrics_record.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:58:07 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 05:58:07 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name compare_slack
+ * @brief qsort order for slack values, smallest first
+ *
+ * @param a Pointer to a long long
+ * @param b Pointer to a long long
+ * @return int Negative, zero or positive like strcmp
+ */
+static int	compare_slack(const void *a, const void *b)
+{
+	long long	x;
+	long long	y;
+
+	x = *(const long long *)a;
+	y = *(const long long *)b;
+	return ((x > y) - (x < y));
+}
+
+/**
+ * @name sample_seats
+ * @brief Counts meals and states and fills the slack buffer
+ *
+ * @param data Pointer to the main data structure
+ * @param s Sample to fill, zeroed by the caller
+ * @param now Current wall time (ms)
+ *
+ * Reads the meal table the monitors already scan, without locking:
+ * ┌─────────────────────────────────────────────────┐
+ * │ eating[i]                      → eating         │
+ * │ fed once, now < last_meal +    → sleeping       │
+ * │ time_to_eat + time_to_sleep                     │
+ * │ anything else                  → thinking, fork │
+ * │                                  waits included │
+ * │ slack = last_meal + time_to_die - now           │
+ * └─────────────────────────────────────────────────┘
+ */
+static void	sample_seats(t_data *data, t_sample *s, long long now)
+{
+	int			i;
+	int			meals;
+	long long	last;
+
+	i = 0;
+	while (i < data->num_philosophers)
+	{
+		last = atomic_load_explicit(&data->meals.last_meal_time[i],
+				memory_order_acquire);
+		meals = atomic_load_explicit(&data->meals.meals_eaten[i],
+				memory_order_relaxed);
+		s->meals += meals;
+		data->metrics.slack[i] = last + data->time_to_die - now;
+		if (atomic_load_explicit(&data->meals.eating[i], memory_order_acquire))
+			s->eating++;
+		else if (meals > 0
+			&& now < last + data->time_to_eat + data->time_to_sleep)
+			s->sleeping++;
+		else
+			s->thinking++;
+		i++;
+	}
+}
+
+/**
+ * @name format_record
+ * @brief Formats one sample as a key=value line or a JSON object
+ *
+ * @param data Pointer to the main data structure
+ * @param s Sample to format
+ * @param buf Destination of METRICS_LINE_SIZE bytes
+ * @return int Length of the record, newline included
+ */
+static int	format_record(t_data *data, t_sample *s, char *buf)
+{
+	if (data->metrics.json)
+		return (snprintf(buf, METRICS_LINE_SIZE, "{\"t_ms\":%lld,"
+				"\"meals\":%lld,\"meals_per_s\":%lld,\"eating\":%d,"
+				"\"thinking\":%d,\"sleeping\":%d,\"slack_min_ms\":%lld,"
+				"\"slack_median_ms\":%lld,\"lines\":%lld}\n", s->t_ms,
+				s->meals, s->per_s, s->eating, s->thinking, s->sleeping,
+				s->slack_min, s->slack_median, s->lines));
+	return (snprintf(buf, METRICS_LINE_SIZE, "metrics t_ms=%lld meals=%lld"
+			" meals_per_s=%lld eating=%d thinking=%d sleeping=%d"
+			" slack_min_ms=%lld slack_median_ms=%lld lines=%lld\n", s->t_ms,
+			s->meals, s->per_s, s->eating, s->thinking, s->sleeping,
+			s->slack_min, s->slack_median, s->lines));
+}
+
+/**
+ * @name metrics_emit
+ * @brief Samples the table and writes one record to the metrics fd
+ *
+ * @param data Pointer to the main data structure
+ *
+ * The meal rate is taken against the previous record (metrics_join
+ * rewinds it to the start for the final one). The median is the upper
+ * middle slack when the count is even.
+ */
+void	metrics_emit(t_data *data)
+{
+	t_sample	s;
+	char		buf[METRICS_LINE_SIZE];
+	long long	now_us;
+	int			len;
+
+	now_us = get_time_us();
+	memset(&s, 0, sizeof(s));
+	s.t_ms = now_us / 1000 - data->start_time;
+	sample_seats(data, &s, now_us / 1000);
+	qsort(data->metrics.slack, data->num_philosophers, sizeof(long long),
+		compare_slack);
+	s.slack_min = data->metrics.slack[0];
+	s.slack_median = data->metrics.slack[data->num_philosophers / 2];
+	if (now_us > data->metrics.last_us)
+		s.per_s = (s.meals - data->metrics.last_meals) * 1000000
+			/ (now_us - data->metrics.last_us);
+	data->metrics.last_meals = s.meals;
+	data->metrics.last_us = now_us;
+	s.lines = atomic_load_explicit(&data->log.lines, memory_order_relaxed);
+	len = format_record(data, &s, buf);
+	if (len > 0)
+		write(data->metrics.fd, buf, len);
+}
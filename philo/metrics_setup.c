@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   metrics_setup.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 05:52:10 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 08:47:13 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name set_metrics_format
+ * @brief Selects how each metrics record is written
+ *
+ * @param data Pointer to the main data structure
+ * @param value "line" or "json"
+ * @return int SUCCESS if value names a format, FAILURE otherwise
+ */
+static int	set_metrics_format(t_data *data, char *value)
+{
+	if (ft_strncmp(value, "line", 5) == 0)
+		data->metrics.json = 0;
+	else if (ft_strncmp(value, "json", 5) == 0)
+		data->metrics.json = 1;
+	else
+		return (dprintf(data->out_fd, "Error: Invalid metrics format %s\n",
+				value), FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @name set_metrics_number
+ * @brief Reads the value of --metrics or --metrics-fd
+ *
+ * @param value Text after '='
+ * @param min Smallest accepted value
+ * @param out Where to store the parsed number
+ * @return int SUCCESS if value is a number of at least min, FAILURE otherwise
+ *
+ * Silent: apply_metrics_option names the option in the error.
+ */
+static int	set_metrics_number(char *value, int min, int *out)
+{
+	int	i;
+
+	i = 0;
+	while (value[i] >= '0' && value[i] <= '9')
+		i++;
+	*out = ft_atoi(value);
+	if (i > 0 && value[i] == '\0' && *out >= min)
+		return (SUCCESS);
+	return (FAILURE);
+}
+
+/**
+ * @name apply_metrics_option
+ * @brief Applies the --metrics options
+ *
+ * @param data Pointer to the main data structure
+ * @param opt Raw command-line word starting with "--"
+ * @return int SUCCESS if the option was applied, FAILURE if its value is
+ *             invalid, OPTION_UNKNOWN if it is not one of these
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ --metrics=MS       one record every MS, and a   │
+ * │                    last one when the run stops  │
+ * │ --metrics-fd=N     where records go (default 2) │
+ * │ --metrics-format=line|json                      │
+ * │                                                 │
+ * │ metrics t_ms=1000 meals=24 meals_per_s=24       │
+ * │   eating=2 thinking=1 sleeping=2                │
+ * │   slack_min_ms=410 slack_median_ms=590 lines=97 │
+ * └─────────────────────────────────────────────────┘
+ */
+int	apply_metrics_option(t_data *data, char *opt)
+{
+	char	*value;
+
+	value = option_value(opt, "--metrics");
+	if (value && set_metrics_number(value, 1, &data->metrics.interval_ms))
+		return (dprintf(data->out_fd, "Error: Invalid metrics interval %s\n",
+				value), FAILURE);
+	if (value)
+		return (SUCCESS);
+	value = option_value(opt, "--metrics-fd");
+	if (value && set_metrics_number(value, 0, &data->metrics.fd))
+		return (dprintf(data->out_fd, "Error: Invalid metrics fd %s\n",
+				value), FAILURE);
+	if (value)
+		return (SUCCESS);
+	value = option_value(opt, "--metrics-format");
+	if (value)
+		return (set_metrics_format(data, value));
+	return (OPTION_UNKNOWN);
+}
+
+/**
+ * @name metrics_init
+ * @brief Checks --metrics fits the run and allocates the slack buffer
+ *
+ * @param data Pointer to the main data structure, arena mapped
+ * @return int SUCCESS if metrics are off or ready, FAILURE otherwise
+ *
+ * Records are stamped with wall time while the run is going, so the
+ * virtual clock of --engine=des has nothing to offer them.
+ */
+int	metrics_init(t_data *data)
+{
+	if (data->metrics.interval_ms <= 0)
+		return (SUCCESS);
+	if (data->engine_mode == ENGINE_DES)
+		return (dprintf(data->out_fd,
+				"Error: --metrics needs real time, not --engine=des\n"),
+			FAILURE);
+	if (fcntl(data->metrics.fd, F_GETFD) < 0)
+		return (dprintf(data->out_fd, "Error: Metrics fd %d is not open\n",
+				data->metrics.fd), FAILURE);
+	data->metrics.slack = arena_alloc(data,
+			sizeof(long long) * data->num_philosophers);
+	if (!data->metrics.slack)
+		return (FAILURE);
+	return (SUCCESS);
+}
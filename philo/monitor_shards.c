@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   monitor_shards.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:21:36 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 06:24:50 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name shard_count
+ * @brief Picks how many monitor threads watch the table
+ *
+ * @param data Pointer to main data structure
+ * @return int --monitors=N if given, otherwise one shard per
+ *             SHARD_MIN_PHILOS philosophers, at most one per core
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ N = 200,  4 cores → 1 monitor (as before)       │
+ * │ N = 2000, 4 cores → 4 monitors, 500 each        │
+ * │ never more monitors than philosophers           │
+ * └─────────────────────────────────────────────────┘
+ */
+int	shard_count(t_data *data)
+{
+	long	count;
+	long	cores;
+
+	count = data->monitor_count;
+	if (count <= 0)
+	{
+		count = data->num_philosophers / SHARD_MIN_PHILOS;
+		cores = sysconf(_SC_NPROCESSORS_ONLN);
+		if (cores > 0 && count > cores)
+			count = cores;
+	}
+	if (count > data->num_philosophers)
+		count = data->num_philosophers;
+	if (count < 1)
+		count = 1;
+	return (count);
+}
+
+/**
+ * @name init_shards
+ * @brief Splits the philosophers into contiguous ranges, one per monitor
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if every shard got its deadline heap, FAILURE
+ *             otherwise
+ *
+ * Shard k watches [k * N / S, (k + 1) * N / S), so sizes differ by at
+ * most one philosopher.
+ */
+int	init_shards(t_data *data)
+{
+	t_shard	*shard;
+	int		k;
+
+	if (data->engine_mode == ENGINE_DES)
+		return (SUCCESS);
+	data->monitor_count = shard_count(data);
+	data->shards = arena_alloc(data, sizeof(t_shard) * data->monitor_count);
+	if (!data->shards)
+		return (FAILURE);
+	k = 0;
+	while (k < data->monitor_count)
+	{
+		shard = &data->shards[k];
+		shard->data = data;
+		shard->first = (long)k * data->num_philosophers / data->monitor_count;
+		shard->count = (long)(k + 1) * data->num_philosophers
+			/ data->monitor_count - shard->first;
+		if (deadline_init(data, &shard->deadlines, shard->count) == FAILURE)
+			return (FAILURE);
+		k++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @name start_monitors
+ * @brief Creates one monitor thread per shard
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if every thread started, FAILURE otherwise
+ */
+int	start_monitors(t_data *data)
+{
+	int	k;
+
+	k = 0;
+	while (k < data->monitor_count)
+	{
+		if (pthread_create(&data->shards[k].thread, &data->thread_attr,
+				monitor_routine, &data->shards[k]) != 0)
+			return (FAILURE);
+		data->shards[k].started = 1;
+		tune_monitor(data, data->shards[k].thread);
+		k++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @name join_monitors
+ * @brief Waits for every monitor thread to finish
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if every join succeeded, FAILURE otherwise
+ */
+int	join_monitors(t_data *data)
+{
+	int	k;
+
+	k = 0;
+	while (k < data->monitor_count)
+	{
+		if (data->shards[k].started
+			&& pthread_join(data->shards[k].thread, NULL) != 0)
+			return (FAILURE);
+		k++;
+	}
+	return (SUCCESS);
+}
@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:41:07 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 08:47:13 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name apply_option
+ * @brief Hands a single "--name=value" option to each group in turn
+ *
+ * @param data Pointer to the main data structure
+ * @param opt Raw command-line word starting with "--"
+ * @return int SUCCESS if the option was applied, FAILURE otherwise
+ *
+ * Every apply_*_option only knows its own options and answers
+ * OPTION_UNKNOWN for the others, so a group is added here and nowhere
+ * else.
+ */
+static int	apply_option(t_data *data, char *opt)
+{
+	int	status;
+
+	status = apply_run_option(data, opt);
+	if (status == OPTION_UNKNOWN)
+		status = apply_think_option(data, opt);
+	if (status == OPTION_UNKNOWN)
+		status = apply_lock_option(data, opt);
+	if (status == OPTION_UNKNOWN)
+		status = apply_metrics_option(data, opt);
+	if (status == OPTION_UNKNOWN)
+		status = apply_affinity_option(data, opt);
+	if (status == OPTION_UNKNOWN)
+		status = apply_numeric_option(data, opt);
+	if (status == OPTION_UNKNOWN)
+		return (dprintf(data->out_fd, "Error: Unknown option %s\n", opt),
+			FAILURE);
+	return (status);
+}
+
+/**
+ * @name parse_options
+ * @brief Consumes "--" options and leaves positional arguments in argv
+ *
+ * @param data Pointer to the main data structure
+ * @param argc Pointer to argument count, updated to the positional count
+ * @param argv Argument values, compacted in place
+ * @return int SUCCESS if every option was valid, FAILURE otherwise
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ ./philo --log=async 5 800 200 200               │
+ * │                                                 │
+ * │ before: argc 6 [philo, --log=async, 5, 800, ...]│
+ * │ after:  argc 5 [philo, 5, 800, 200, 200]        │
+ * │                                                 │
+ * │ Options may appear anywhere on the command line │
+ * └─────────────────────────────────────────────────┘
+ */
+int	parse_options(t_data *data, int *argc, char **argv)
+{
+	int	i;
+	int	kept;
+
+	i = 1;
+	kept = 1;
+	data->monitor_cpu = -1;
+	data->trace_fd = -1;
+	data->metrics.fd = STDERR_FILENO;
+	while (i < *argc)
+	{
+		if (ft_strncmp(argv[i], "--", 2) == 0)
+		{
+			if (apply_option(data, argv[i]) == FAILURE)
+				return (FAILURE);
+		}
+		else
+		{
+			argv[kept] = argv[i];
+			kept++;
+		}
+		i++;
+	}
+	*argc = kept;
+	argv[kept] = NULL;
+	return (SUCCESS);
+}
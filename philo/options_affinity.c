@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_affinity.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:03:16 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 08:47:13 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name set_pin_mode
+ * @brief Selects where philosopher threads may run
+ *
+ * @param data Pointer to the main data structure
+ * @param value "none" (the kernel decides), "rr" (philosopher i on the
+ *              i-th allowed CPU, wrapping) or "packed" (contiguous
+ *              blocks of neighbours per CPU)
+ * @return int SUCCESS if the value is known, FAILURE otherwise
+ */
+static int	set_pin_mode(t_data *data, char *value)
+{
+	if (ft_strncmp(value, "none", 5) == 0)
+		data->pin_mode = PIN_NONE;
+	else if (ft_strncmp(value, "rr", 3) == 0)
+		data->pin_mode = PIN_RR;
+	else if (ft_strncmp(value, "packed", 7) == 0)
+		data->pin_mode = PIN_PACKED;
+	else
+		return (dprintf(data->out_fd, "Error: Invalid pin mode %s\n", value),
+			FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @name set_monitor_cpu
+ * @brief Reads the CPU the monitor threads are pinned to
+ *
+ * @param data Pointer to the main data structure
+ * @param value CPU number as the kernel counts them, 0 included
+ * @return int SUCCESS if value is a usable CPU number, FAILURE otherwise
+ *
+ * Whether the process may run there is checked later, in init_affinity.
+ */
+static int	set_monitor_cpu(t_data *data, char *value)
+{
+	data->monitor_cpu = ft_atoi(value);
+	if (value[0] >= '0' && value[0] <= '9' && data->monitor_cpu >= 0
+		&& data->monitor_cpu < CPU_SETSIZE)
+		return (SUCCESS);
+	return (dprintf(data->out_fd, "Error: Invalid monitor CPU %s\n", value),
+		FAILURE);
+}
+
+/**
+ * @name set_monitor_sched
+ * @brief Selects the scheduling policy of the monitor threads
+ *
+ * @param data Pointer to the main data structure
+ * @param value "other" (default time sharing) or "fifo" (SCHED_FIFO at
+ *              the lowest real-time priority, if we are allowed to)
+ * @return int SUCCESS if the value is known, FAILURE otherwise
+ */
+static int	set_monitor_sched(t_data *data, char *value)
+{
+	if (ft_strncmp(value, "other", 6) == 0)
+		data->monitor_fifo = 0;
+	else if (ft_strncmp(value, "fifo", 5) == 0)
+		data->monitor_fifo = 1;
+	else
+		return (dprintf(data->out_fd, "Error: Invalid monitor policy %s\n",
+				value), FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @name set_huge_mode
+ * @brief Selects the pages backing the per-run arena
+ *
+ * @param data Pointer to the main data structure
+ * @param value "off" (normal pages), "thp" (transparent huge pages) or
+ *              "on" (explicit huge pages from the reserved pool)
+ * @return int SUCCESS if the value is known, FAILURE otherwise
+ */
+static int	set_huge_mode(t_data *data, char *value)
+{
+	if (ft_strncmp(value, "off", 4) == 0)
+		data->huge_mode = HUGE_OFF;
+	else if (ft_strncmp(value, "thp", 4) == 0)
+		data->huge_mode = HUGE_THP;
+	else if (ft_strncmp(value, "on", 3) == 0)
+		data->huge_mode = HUGE_ON;
+	else
+		return (dprintf(data->out_fd, "Error: Invalid huge page mode %s\n",
+				value), FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @name apply_affinity_option
+ * @brief Applies the options that place threads and memory
+ *
+ * @param data Pointer to the main data structure
+ * @param opt Raw command-line word starting with "--"
+ * @return int SUCCESS if the option was applied, FAILURE if its value is
+ *             invalid, OPTION_UNKNOWN if it is not one of these
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ --pin=rr|packed      philosopher placement      │
+ * │ --monitor-cpu=N      monitors on CPU N, which   │
+ * │                      philosophers then avoid    │
+ * │ --monitor-sched=fifo monitors under SCHED_FIFO, │
+ * │                      time sharing if refused    │
+ * │ --huge=thp|on        arena on huge pages        │
+ * └─────────────────────────────────────────────────┘
+ */
+int	apply_affinity_option(t_data *data, char *opt)
+{
+	char	*value;
+
+	value = option_value(opt, "--pin");
+	if (value)
+		return (set_pin_mode(data, value));
+	value = option_value(opt, "--monitor-cpu");
+	if (value)
+		return (set_monitor_cpu(data, value));
+	value = option_value(opt, "--monitor-sched");
+	if (value)
+		return (set_monitor_sched(data, value));
+	value = option_value(opt, "--huge");
+	if (value)
+		return (set_huge_mode(data, value));
+	return (OPTION_UNKNOWN);
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_numeric.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:58:41 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 08:47:13 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name option_value
+ * @brief Returns the value part of a "--name=value" option
+ *
+ * @param opt Raw command-line word
+ * @param name Option name including the leading dashes
+ * @return char* Pointer just past '=', or NULL if opt is another option
+ */
+char	*option_value(char *opt, char *name)
+{
+	size_t	len;
+
+	len = strlen(name);
+	if (ft_strncmp(opt, name, len) != 0 || opt[len] != '=')
+		return (NULL);
+	return (opt + len + 1);
+}
+
+/**
+ * @name parse_positive
+ * @brief Reads a strictly positive integer option value
+ *
+ * @param data Pointer to the main data structure, for its out_fd
+ * @param value Text after '='
+ * @param what Option description used in the error message
+ * @param out Where to store the parsed number
+ * @return int SUCCESS if value is a positive integer, FAILURE otherwise
+ */
+static int	parse_positive(t_data *data, char *value, char *what, int *out)
+{
+	*out = ft_atoi(value);
+	if (*out > 0)
+		return (SUCCESS);
+	return (dprintf(data->out_fd, "Error: Invalid %s %s\n", what, value),
+		FAILURE);
+}
+
+/**
+ * @name apply_numeric_option
+ * @brief Applies the options that take a number
+ *
+ * @param data Pointer to the main data structure
+ * @param opt Raw command-line word starting with "--"
+ * @return int SUCCESS if the option was applied, FAILURE if its value is
+ *             invalid, OPTION_UNKNOWN if it is not one of these
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ --workers=N  worker threads for --engine=coro   │
+ * │ --monitors=N monitor shards (default: one per   │
+ * │              SHARD_MIN_PHILOS, capped by cores) │
+ * │ --stack=KB   stack of every thread (default     │
+ * │              THREAD_STACK_KB, at least          │
+ * │              PTHREAD_STACK_MIN)                 │
+ * │ --latency=MS record death timings and slack     │
+ * │              histograms, report near misses     │
+ * │              with less than MS of slack         │
+ * │ --until=MS   virtual time limit for --engine=des│
+ * │              (runs until a death or every meal  │
+ * │              is eaten when not given)           │
+ * └─────────────────────────────────────────────────┘
+ */
+int	apply_numeric_option(t_data *data, char *opt)
+{
+	char	*value;
+	int		ms;
+
+	value = option_value(opt, "--workers");
+	if (value)
+		return (parse_positive(data, value, "worker count",
+				&data->worker_count));
+	value = option_value(opt, "--monitors");
+	if (value)
+		return (parse_positive(data, value, "monitor count",
+				&data->monitor_count));
+	value = option_value(opt, "--stack");
+	if (value)
+		return (parse_positive(data, value, "stack size", &data->stack_kb));
+	value = option_value(opt, "--latency");
+	if (value)
+		return (parse_positive(data, value, "near-miss slack",
+				&data->near_ms));
+	value = option_value(opt, "--until");
+	if (!value)
+		return (OPTION_UNKNOWN);
+	if (parse_positive(data, value, "time limit", &ms) == FAILURE)
+		return (FAILURE);
+	data->until = ms * 1000LL;
+	return (SUCCESS);
+}
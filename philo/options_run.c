@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options_run.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:15:42 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 08:47:13 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name set_log_mode
+ * @brief Selects how status lines reach stdout
+ *
+ * @param data Pointer to the main data structure
+ * @param value "sync" (printf under print_mutex), "async" (ring buffers
+ *              drained by a dedicated writer thread) or "none" (no
+ *              output, for runs watched through --shm)
+ * @return int SUCCESS if the value is known, FAILURE otherwise
+ */
+static int	set_log_mode(t_data *data, char *value)
+{
+	if (ft_strncmp(value, "sync", 5) == 0)
+		data->log_mode = LOG_SYNC;
+	else if (ft_strncmp(value, "async", 6) == 0)
+		data->log_mode = LOG_ASYNC;
+	else if (ft_strncmp(value, "none", 5) == 0)
+		data->log_mode = LOG_NONE;
+	else
+		return (dprintf(data->out_fd, "Error: Invalid log mode %s\n", value),
+			FAILURE);
+	data->log_set = 1;
+	return (SUCCESS);
+}
+
+/**
+ * @name set_engine_mode
+ * @brief Selects how philosophers are executed
+ *
+ * @param data Pointer to the main data structure
+ * @param value "threads" (one pthread each), "coro" (coroutines on a
+ *              pool of worker threads) or "des" (single-threaded
+ *              discrete-event simulation in virtual time)
+ * @return int SUCCESS if the value is known, FAILURE otherwise
+ */
+static int	set_engine_mode(t_data *data, char *value)
+{
+	if (ft_strncmp(value, "threads", 8) == 0)
+		data->engine_mode = ENGINE_THREADS;
+	else if (ft_strncmp(value, "coro", 5) == 0)
+		data->engine_mode = ENGINE_CORO;
+	else if (ft_strncmp(value, "des", 4) == 0)
+		data->engine_mode = ENGINE_DES;
+	else
+		return (dprintf(data->out_fd, "Error: Invalid engine %s\n", value),
+			FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @name set_fork_mode
+ * @brief Selects how neighbours arbitrate their shared forks
+ *
+ * @param data Pointer to the main data structure
+ * @param value "ordered" (odd/even fork order plus a 1 ms head start) or
+ *              "hygienic" (Chandy-Misra clean/dirty forks, threads only)
+ * @return int SUCCESS if the value is known, FAILURE otherwise
+ */
+static int	set_fork_mode(t_data *data, char *value)
+{
+	if (ft_strncmp(value, "ordered", 8) == 0)
+		data->fork_mode = FORKS_ORDERED;
+	else if (ft_strncmp(value, "hygienic", 9) == 0)
+		data->fork_mode = FORKS_HYGIENIC;
+	else
+		return (dprintf(data->out_fd, "Error: Invalid fork mode %s\n", value),
+			FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @name apply_run_option
+ * @brief Applies the options that choose the engine, forks and outputs
+ *
+ * @param data Pointer to the main data structure
+ * @param opt Raw command-line word starting with "--"
+ * @return int SUCCESS if the option was applied, FAILURE if its value is
+ *             invalid, OPTION_UNKNOWN if it is not one of these
+ */
+int	apply_run_option(t_data *data, char *opt)
+{
+	char	*value;
+
+	value = option_value(opt, "--log");
+	if (value)
+		return (set_log_mode(data, value));
+	value = option_value(opt, "--engine");
+	if (value)
+		return (set_engine_mode(data, value));
+	value = option_value(opt, "--forks");
+	if (value)
+		return (set_fork_mode(data, value));
+	value = option_value(opt, "--trace");
+	if (value)
+	{
+		data->trace_path = value;
+		return (SUCCESS);
+	}
+	value = option_value(opt, "--shm");
+	if (value)
+	{
+		data->shm_name = value;
+		return (SUCCESS);
+	}
+	return (OPTION_UNKNOWN);
+}
@@ -6,7 +6,7 @@
 /*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/11 15:45:00 by mkurkar           #+#    #+#             */
-/*   Updated: 2025/06/16 10:31:33 by mkurkar          ###   ########.fr       */
+/*   Updated: 2026/10/19 07:34:40 by mkurkar          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,6 +19,9 @@
  * @param philo Pointer to philosopher structure
  * @param first Pointer to store the first fork to grab
  * @param second Pointer to store the second fork to grab
+ *
+ * Called once per philosopher by init_philosophers, which keeps the
+ * answer in first_fork and second_fork for every meal of the run.
  */
 void	setup_forks(t_philo *philo, t_fork **first, t_fork **second)
 {
@@ -35,76 +38,89 @@ void	setup_forks(t_philo *philo, t_fork **first, t_fork **second)
 }
 
 /**
- * @name handle_single_philo
- * @brief Special case handler for when there is only one philosopher
+ * @name philo_alone
+ * @brief The whole life of a lone philosopher: one fork, then starvation
  *
- * @param philo Pointer to philosopher structure
- * @param first Pointer to the first fork
- * @return int 1 if there's only one philosopher, 0 otherwise
+ * @param philo The only philosopher
+ *
+ * The second fork never comes, so philosopher_routine runs this instead
+ * of the meal loop rather than testing num_philosophers on every grab.
+ * Nobody else can want the fork, so it is not locked: with
+ * --forks=hygienic, dropping a fork that had been locked used to
+ * deadlock on its own mutex.
  */
-int	handle_single_philo(t_philo *philo, t_fork *first)
+void	philo_alone(t_philo *philo)
 {
-	if (philo->data->num_philosophers == 1)
-	{
-		pthread_mutex_unlock(&first->mutex);
-		precise_sleep(philo->data->time_to_die);
-		return (1);
-	}
-	return (0);
+	if (check_simulation_stop(philo))
+		return ;
+	philo->data->act.print(philo, ST_FORK);
+	engine_sleep_until(philo, get_time_us()
+		+ philo->data->time_to_die * 1000LL);
 }
 
 /**
  * @name update_meal_status
- * @brief Updates philosopher's meal status in a thread-safe manner
+ * @brief Publishes philosopher's meal status without taking any lock
  *
  * @param philo Pointer to philosopher structure
  * @param is_eating 1 if starting to eat, 0 if finished eating
+ *
+ * The meal time is released before the eating flag so the monitor,
+ * which acquires the flag first, always pairs it with a fresh time.
+ * The meal start also anchors phase_end, from which the eat and sleep
+ * deadlines are chained. The meal that feeds a philosopher for the
+ * must_eat_count-th time takes it off meals_left, exactly once; the
+ * last one to get there stops the simulation, O(1) and without polling.
  */
 void	update_meal_status(t_philo *philo, int is_eating)
 {
-	pthread_mutex_lock(&philo->meal_mutex);
 	if (is_eating)
 	{
-		philo->eating = 1;
-		philo->last_meal_time = get_time();
+		philo->phase_end = get_time_us();
+		atomic_store_explicit(philo->last_meal_time, philo->phase_end / 1000,
+			memory_order_release);
+		atomic_store_explicit(philo->eating, 1, memory_order_release);
 	}
 	else
 	{
-		philo->eating = 0;
-		philo->meals_eaten++;
+		atomic_store_explicit(philo->eating, 0, memory_order_release);
+		if (atomic_fetch_add_explicit(philo->meals_eaten, 1,
+				memory_order_release) + 1 == philo->data->must_eat_count
+			&& atomic_fetch_sub_explicit(&philo->data->meals_left, 1,
+				memory_order_acq_rel) == 1)
+			stop_all_fed(philo->data);
 	}
-	pthread_mutex_unlock(&philo->meal_mutex);
 }
 
 /**
- * @name acquire_forks
- * @brief Acquires both forks for eating
+ * @name ordered_acquire
+ * @brief Acquires both forks for eating, in the order given
  *
  * @param philo Pointer to philosopher structure
  * @param first_fork First fork to acquire
  * @param second_fork Second fork to acquire
  * @return int SUCCESS if both forks acquired, FAILURE otherwise
+ *
+ * The acquire action unless --forks=hygienic. On a stop it puts back
+ * exactly the forks it was given, whoever the caller is.
  */
-static int	acquire_forks(t_philo *philo, t_fork *first_fork,
-	t_fork *second_fork)
+int	ordered_acquire(t_philo *philo, t_fork *first_fork, t_fork *second_fork)
 {
-	pthread_mutex_lock(&first_fork->mutex);
+	philo->data->act.take(philo, first_fork);
 	if (check_simulation_stop(philo))
 	{
-		pthread_mutex_unlock(&first_fork->mutex);
+		philo->data->act.drop(philo, first_fork);
 		return (FAILURE);
 	}
-	print_status(philo, "has taken a fork");
-	if (handle_single_philo(philo, first_fork))
-		return (FAILURE);
-	pthread_mutex_lock(&second_fork->mutex);
+	philo->data->act.print(philo, ST_FORK);
+	philo->data->act.take(philo, second_fork);
 	if (check_simulation_stop(philo))
 	{
-		pthread_mutex_unlock(&second_fork->mutex);
-		pthread_mutex_unlock(&first_fork->mutex);
+		philo->data->act.drop(philo, second_fork);
+		philo->data->act.drop(philo, first_fork);
 		return (FAILURE);
 	}
-	print_status(philo, "has taken a fork");
+	philo->data->act.print(philo, ST_FORK);
 	return (SUCCESS);
 }
 
@@ -117,25 +133,27 @@ static int	acquire_forks(t_philo *philo, t_fork *first_fork,
  */
 int	philo_eat(t_philo *philo)
 {
-	t_fork	*first_fork;
-	t_fork	*second_fork;
+	long long	deadline;
 
 	if (check_simulation_stop(philo))
 		return (FAILURE);
-	setup_forks(philo, &first_fork, &second_fork);
-	if (acquire_forks(philo, first_fork, second_fork) == FAILURE)
+	if (philo->data->act.acquire(philo, philo->first_fork,
+			philo->second_fork) == FAILURE)
 		return (FAILURE);
+	deadline = atomic_load_explicit(philo->last_meal_time,
+			memory_order_relaxed) + philo->data->time_to_die;
 	update_meal_status(philo, 1);
-	print_status(philo, "is eating");
+	philo->data->act.print(philo, ST_EAT);
+	latency_meal(philo, deadline);
 	if (interruptible_sleep(philo, philo->data->time_to_eat) == FAILURE)
 	{
 		update_meal_status(philo, 0);
-		pthread_mutex_unlock(&second_fork->mutex);
-		pthread_mutex_unlock(&first_fork->mutex);
+		philo->data->act.drop(philo, philo->second_fork);
+		philo->data->act.drop(philo, philo->first_fork);
 		return (FAILURE);
 	}
 	update_meal_status(philo, 0);
-	pthread_mutex_unlock(&second_fork->mutex);
-	pthread_mutex_unlock(&first_fork->mutex);
+	philo->data->act.drop(philo, philo->second_fork);
+	philo->data->act.drop(philo, philo->first_fork);
 	return (SUCCESS);
 }
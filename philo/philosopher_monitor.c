@@ -6,143 +6,67 @@
 /*   By: mkurkar <mkurkar@student.42amman.com>      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/25 11:31:46 by mkurkar           #+#    #+#             */
-/*   Updated: 2025/05/25 15:54:51 by mkurkar          ###   ########.fr       */
+/*   Updated: 2026/10/19 01:10:12 by mkurkar          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "philosophers.h"
 
 /**
- * @name check_philo_death
- * @brief Checks if a specific philosopher has died of starvation
+ * @name check_due_philo
+ * @brief Checks the philosopher with the earliest deadline
  *
  * @param data Pointer to main data structure
- * @param philos Pointer to array of philosophers
- * @param i Index of philosopher to check
+ * @param dl Monitor's deadline heap
  * @return int 1 if the philosopher has died, 0 otherwise
  *
  * Example:
  * ┌─────────────────────────────────────────────────┐
  * │ Death Check Algorithm:                          │
  * │                                                 │
- * │ 1. Lock philosopher's meal mutex                │
- * │ 2. Get current time                             │
- * │ 3. Calculate time since last meal:              │
- * │    current_time - last_meal_time                │
+ * │ 1. Take heap[0], the earliest known deadline    │
+ * │ 2. Load eating flag (acquire), then last meal   │
+ * │    time - no lock, the eater never waits on us  │
+ * │ 3. Real deadline = last_meal_time + time_to_die │
+ * │    (an eater is given at least one more ms)     │
  * │                                                 │
- * │ 4. If not eating AND time since last meal       │
- * │    exceeds time_to_die:                         │
- * │    a. Unlock meal mutex                         │
- * │    b. Lock print and state mutexes              │
- * │    c. Stop the simulation                       │
- * │    d. Print death message                       │
- * │    e. Return 1 (philosopher died)               │
+ * │ 4. If the real deadline is still ahead:         │
+ * │    re-key heap[0] and return 0 (alive)          │
  * │                                                 │
- * │ 5. Otherwise, unlock and return 0 (alive)       │
- * └─────────────────────────────────────────────────┘
- */
-static int	check_philo_death(t_data *data, t_philo *philos, int i)
-{
-	long long	current_time;
-
-	pthread_mutex_lock(&philos[i].meal_mutex);
-	current_time = get_time();
-	if (!philos[i].eating && (current_time
-			- philos[i].last_meal_time) >= data->time_to_die)
-	{
-		pthread_mutex_unlock(&philos[i].meal_mutex);
-		pthread_mutex_lock(&data->print_mutex);
-		pthread_mutex_lock(&data->state_mutex);
-		data->simulation_stop = 1;
-		printf("%lld %d died\n", get_time() - data->start_time, philos[i].id);
-		pthread_mutex_unlock(&data->state_mutex);
-		pthread_mutex_unlock(&data->print_mutex);
-		return (1);
-	}
-	pthread_mutex_unlock(&philos[i].meal_mutex);
-	return (0);
-}
-
-/**
- * @name check_all_philos
- * @brief Checks all philosophers to see if any have died
- *
- * @param data Pointer to main data structure
- * @param philos Pointer to array of philosophers
- * @return int 1 if any philosopher has died, 0 otherwise
- *
- * Example:
- * ┌─────────────────────────────────────────────────┐
- * │ All Philosophers Check:                         │
+ * │ 5. Otherwise stop the simulation, announce the  │
+ * │    death (see announce_death) and return 1      │
  * │                                                 │
- * │ 1. Iterate through all philosophers             │
- * │ 2. For each one, check if they've died          │
- * │ 3. If any one has died, return 1 immediately    │
- * │ 4. If none have died, return 0                  │
- * │                                                 │
- * │ This is called periodically by monitor thread   │
+ * │ With --latency, how late the check ran and the  │
+ * │ death's timings are recorded as well            │
  * └─────────────────────────────────────────────────┘
  */
-static int	check_all_philos(t_data *data, t_philo *philos)
+static int	check_due_philo(t_data *data, t_deadlines *dl)
 {
-	int	i;
+	t_philo		*philo;
+	long long	deadline;
+	long long	now_us;
+	long long	now;
+	int			eating;
 
-	i = 0;
-	while (i < data->num_philosophers)
+	philo = &data->philosophers[dl->heap[0].idx];
+	eating = atomic_load_explicit(philo->eating, memory_order_acquire);
+	deadline = atomic_load_explicit(philo->last_meal_time,
+			memory_order_acquire) + data->time_to_die;
+	now_us = get_time_us();
+	now = now_us / 1000;
+	latency_lag(data, dl->heap[0].key, now_us);
+	if (eating && deadline <= now)
+		deadline = now + 1;
+	if (deadline > now)
 	{
-		if (check_philo_death(data, philos, i))
-			return (1);
-		i++;
+		deadline_rekey(dl, deadline);
+		return (0);
 	}
-	return (0);
-}
-
-/**
- * @name check_if_all_ate
- * @brief Checks if all philosophers have eaten enough times
- *
- * @param data Pointer to main data structure
- * @param philos Pointer to array of philosophers
- * @return int 1 if all philosophers have eaten enough, 0 otherwise
- *
- * Example:
- * ┌─────────────────────────────────────────────────┐
- * │ Check Algorithm:                                │
- * │                                                 │
- * │ 1. Set flag all_ate_enough = true (1)           │
- * │ 2. For each philosopher:                        │
- * │    a. Lock philosopher's meal mutex             │
- * │    b. Check if meals_eaten < must_eat_count     │
- * │    c. If any philosopher hasn't eaten enough:   │
- * │       - Set flag to false (0)                   │
- * │       - Break the loop early                    │
- * │    d. Unlock mutex and continue                 │
- * │ 3. Return the flag value                        │
- * │                                                 │
- * │ This is used to end simulation when all have    │
- * │ eaten their required number of meals            │
- * └─────────────────────────────────────────────────┘
- */
-static int	check_if_all_ate(t_data *data, t_philo *philos)
-{
-	int	j;
-	int	all_ate_enough;
-
-	all_ate_enough = 1;
-	j = 0;
-	while (j < data->num_philosophers)
-	{
-		pthread_mutex_lock(&philos[j].meal_mutex);
-		if (philos[j].meals_eaten < data->must_eat_count)
-		{
-			all_ate_enough = 0;
-			pthread_mutex_unlock(&philos[j].meal_mutex);
-			break ;
-		}
-		pthread_mutex_unlock(&philos[j].meal_mutex);
-		j++;
-	}
-	return (all_ate_enough);
+	if (!announce_death(data, philo))
+		return (1);
+	latency_death(data, philo, deadline, now_us);
+	shm_phase(data, SHM_STOPPED, philo->id);
+	return (1);
 }
 
 /**
@@ -155,34 +79,25 @@ static int	check_if_all_ate(t_data *data, t_philo *philos)
  * ┌─────────────────────────────────────────────────┐
  * │ Monitor Wait Mechanism:                         │
  * │                                                 │
- * │ 1. Lock state mutex                             │
- * │ 2. Check if all threads are ready               │
- * │ 3. If not, unlock and briefly sleep             │
- * │ 4. Reacquire lock and check again               │
- * │ 5. Once all threads are ready, continue         │
- * │ 6. Additional 1ms sleep for synchronization     │
+ * │ 1. Block on the start gate, like philosophers   │
+ * │ 2. Additional 1ms sleep for synchronization     │
  * │                                                 │
- * │ Similar to philosopher wait but with extra delay│
+ * │ Philosophers stamp their first meal time right  │
+ * │ after the gate; the delay lets them do so       │
+ * │ before the deadline heap is built               │
  * └─────────────────────────────────────────────────┘
  */
 static void	wait_for_threads_ready(t_data *data)
 {
-	pthread_mutex_lock(&data->state_mutex);
-	while (!data->all_threads_ready)
-	{
-		pthread_mutex_unlock(&data->state_mutex);
-		usleep(100);
-		pthread_mutex_lock(&data->state_mutex);
-	}
-	pthread_mutex_unlock(&data->state_mutex);
+	wait_for_all_threads(data);
 	usleep(1000);
 }
 
 /**
  * @name monitor_routine
- * @brief Monitor thread that checks for death or meal completion
+ * @brief Monitor thread that checks its shard for deaths
  *
- * @param arg Void pointer to main data structure
+ * @param arg Void pointer to the monitor's t_shard
  * @return void* NULL
  *
  * Example:
@@ -190,45 +105,37 @@ static void	wait_for_threads_ready(t_data *data)
  * │ Monitor Thread Responsibilities:                │
  * │                                                 │
  * │ 1. Wait for all threads to be ready             │
- * │ 2. Enter monitoring loop:                       │
- * │    a. If must_eat_count is set:                 │
- * │       - Check if all philosophers have eaten    │
- * │         enough meals                            │
- * │       - If yes, stop simulation and exit        │
+ * │ 2. Build the shard's deadline heap from the     │
+ * │    meal times of its range                      │
+ * │ 3. Enter monitoring loop:                       │
+ * │    a. Check the philosopher due first           │
+ * │       - If dead, exit (death already announced) │
  * │                                                 │
- * │    b. Check if any philosopher has died         │
- * │       - If yes, exit (death already announced)  │
+ * │    b. Sleep until the next deadline, instead of │
+ * │       scanning all N philosophers every ms      │
  * │                                                 │
- * │    c. Brief sleep to reduce CPU usage           │
- * │                                                 │
- * │ The monitor ensures simulation stops correctly  │
+ * │ Shards share the stop flag: the first death     │
+ * │ found by any of them ends the whole simulation. │
+ * │ Must-eat completion is not polled: the last     │
+ * │ philosopher to be fed stops the simulation      │
+ * │ (update_meal_status), and stop_cond wakes us    │
  * └─────────────────────────────────────────────────┘
  */
 void	*monitor_routine(void *arg)
 {
+	t_shard	*shard;
 	t_data	*data;
-	t_philo	*philos;
 
-	data = (t_data *)arg;
-	philos = data->philosophers;
+	shard = (t_shard *)arg;
+	data = shard->data;
 	wait_for_threads_ready(data);
+	deadline_reset(&shard->deadlines, data, shard->first);
 	while (1)
 	{
-		if (data->must_eat_count != -1)
-		{
-			if (check_if_all_ate(data, philos))
-			{
-				pthread_mutex_lock(&data->print_mutex);
-				pthread_mutex_lock(&data->state_mutex);
-				data->simulation_stop = 1;
-				pthread_mutex_unlock(&data->state_mutex);
-				pthread_mutex_unlock(&data->print_mutex);
-				return (NULL);
-			}
-		}
-		if (check_all_philos(data, philos))
+		if (check_due_philo(data, &shard->deadlines))
+			return (NULL);
+		if (sleep_until(data, shard->deadlines.heap[0].key * 1000) == FAILURE)
 			return (NULL);
-		usleep(1000);
 	}
 	return (NULL);
 }
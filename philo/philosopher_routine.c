@@ -6,7 +6,7 @@
 /*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/25 09:42:47 by mkurkar           #+#    #+#             */
-/*   Updated: 2025/06/11 15:46:14 by mkurkar          ###   ########.fr       */
+/*   Updated: 2026/10/19 03:31:08 by mkurkar          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,12 +20,11 @@
  */
 static void	init_philosopher_state(t_philo *philo)
 {
-	wait_for_all_threads(philo);
-	if (philo->id % 2 == 0)
-		usleep(1000);
-	pthread_mutex_lock(&philo->meal_mutex);
-	philo->last_meal_time = get_time();
-	pthread_mutex_unlock(&philo->meal_mutex);
+	wait_for_all_threads(philo->data);
+	if (philo->id % 2 == 0 && philo->data->fork_mode == FORKS_ORDERED)
+		engine_pause(philo, 1000);
+	atomic_store_explicit(philo->last_meal_time, get_time(),
+		memory_order_release);
 }
 
 /**
@@ -46,22 +45,43 @@ static int	should_stop_simulation(t_philo *philo)
 }
 
 /**
- * @name has_eaten_enough
- * @brief Checks if philosopher has eaten required number of meals
+ * @name dine_forever
+ * @brief Meal loop of a run without a must-eat count
  *
  * @param philo Pointer to philosopher structure
- * @return int 1 if has eaten enough, 0 otherwise
  */
-static int	has_eaten_enough(t_philo *philo)
+static void	dine_forever(t_philo *philo)
 {
-	int	enough;
+	while (!should_stop_simulation(philo))
+	{
+		if (philo_eat(philo) == FAILURE || philo_sleep(philo) == FAILURE
+			|| philo_think(philo) == FAILURE)
+			break ;
+	}
+}
+
+/**
+ * @name dine_counted
+ * @brief Meal loop of a run with a must-eat count
+ *
+ * @param philo Pointer to philosopher structure
+ *
+ * The meals still to eat are counted down locally instead of reloading
+ * the shared meals_eaten counter every cycle.
+ */
+static void	dine_counted(t_philo *philo)
+{
+	int	left;
 
-	if (philo->data->must_eat_count == -1)
-		return (0);
-	pthread_mutex_lock(&philo->meal_mutex);
-	enough = (philo->meals_eaten >= philo->data->must_eat_count);
-	pthread_mutex_unlock(&philo->meal_mutex);
-	return (enough);
+	left = philo->data->must_eat_count;
+	while (left > 0 && !should_stop_simulation(philo))
+	{
+		if (philo_eat(philo) == FAILURE)
+			break ;
+		left--;
+		if (philo_sleep(philo) == FAILURE || philo_think(philo) == FAILURE)
+			break ;
+	}
 }
 
 /**
@@ -70,6 +90,18 @@ static int	has_eaten_enough(t_philo *philo)
  *
  * @param arg Void pointer to philosopher structure
  * @return void* NULL
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ The loop is picked once, so no cycle re-tests   │
+ * │ what cannot change during a run:                │
+ * │                                                 │
+ * │ 1 philosopher      → philo_alone                │
+ * │ no must_eat        → dine_forever               │
+ * │ must_eat given     → dine_counted               │
+ * │                                                 │
+ * │ The fork order was fixed by init_philosophers   │
+ * └─────────────────────────────────────────────────┘
  */
 void	*philosopher_routine(void *arg)
 {
@@ -77,15 +109,11 @@ void	*philosopher_routine(void *arg)
 
 	philo = (t_philo *)arg;
 	init_philosopher_state(philo);
-	while (1)
-	{
-		if (should_stop_simulation(philo))
-			break ;
-		if (has_eaten_enough(philo))
-			break ;
-		if (philo_eat(philo) == FAILURE || philo_sleep(philo) == FAILURE
-			|| philo_think(philo) == FAILURE)
-			break ;
-	}
+	if (philo->data->num_philosophers == 1)
+		philo_alone(philo);
+	else if (philo->data->must_eat_count == -1)
+		dine_forever(philo);
+	else
+		dine_counted(philo);
 	return (NULL);
 }
@@ -6,19 +6,34 @@
 /*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/05 17:27:46 by mkurkar           #+#    #+#             */
-/*   Updated: 2025/06/16 10:34:57 by mkurkar          ###   ########.fr       */
+/*   Updated: 2026/10/19 08:29:51 by mkurkar          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef PHILOSOPHERS_H
 # define PHILOSOPHERS_H
+/* cpu_set_t and pthread_setaffinity_np (--pin, --monitor-cpu) */
+# define _GNU_SOURCE
+# include <fcntl.h>
 # include <limits.h>
+# include <linux/futex.h>
 # include <pthread.h>
+# include <stdatomic.h>
+# include <stdint.h>
 # include <stdio.h>
 # include <stdlib.h>
 # include <string.h>
+# include <sched.h>
+# include <sys/mman.h>
+# include <sys/resource.h>
+# include <sys/stat.h>
+# include <sys/syscall.h>
 # include <sys/time.h>
+# include <time.h>
+# include <ucontext.h>
 # include <unistd.h>
+# include "shm_layout.h"
+# include "trace_layout.h"
 
 typedef enum e_exit_status
 {
@@ -31,26 +46,533 @@ typedef enum e_exit_status
 # define FAILURE 1
 */
 
+/* apply_*_option: the option belongs to another group */
+# define OPTION_UNKNOWN 2
+
+/* Final stretch of every sleep that is spun instead of blocked, in µs */
+# define SLEEP_SPIN_US 500
+
+/* Shared data is aligned to this so two writers never share a line */
+# define CACHE_LINE 64
+
+/* Thinking time of --think=fixed, in µs */
+# define THINK_FIXED_US 500
+/* --think=adaptive: reach for forks at least this long before dying */
+# define THINK_MARGIN_US 2000
+
+/* --batch=FILE: most words on one scenario line, and longest output path */
+# define BATCH_ARGS 32
+# define BATCH_PATH_SIZE 256
+
+/* --fork-lock=spin|fifo: most spin rounds before parking (glibc's own
+** adaptive mutex cap), and the states of the spin lock word */
+# define FORK_SPIN_MAX 100
+# define LOCK_FREE 0
+# define LOCK_TAKEN 1
+# define LOCK_WAITED 2
+/* --fork-lock=fifo: whether a waiter may be parked on serving */
+# define FIFO_IDLE 0
+# define FIFO_PARKED 1
+/* Spin-wait hint issued once per round of those spins */
+# if defined(__x86_64__) || defined(__i386__)
+#  define CPU_RELAX "pause"
+# elif defined(__aarch64__) || defined(__arm__)
+#  define CPU_RELAX "yield"
+# else
+#  define CPU_RELAX ""
+# endif
+
+/* Size of a huge page, for aligning and rounding the --huge arena */
+# define HUGE_PAGE 2097152
+
+/* Philosophers per monitor shard below which no extra shard is spawned */
+# define SHARD_MIN_PHILOS 256
+
+/* Default stack of every thread we create, in KB (--stack=KB) */
+# define THREAD_STACK_KB 64
+/* Philosophers per spawner thread, and the most spawners ever started */
+# define SPAWN_MIN_PHILOS 256
+# define SPAWN_MAX 8
+
+/* Latency histograms (--latency=MS): 2^LAT_SUB_BITS buckets per power
+** of two in µs, i.e. about 3 % resolution up to 2^(LAT_MAGS + 4) µs */
+# define LAT_SUB_BITS 5
+# define LAT_MAGS 40
+# define LAT_BUCKETS 1280
+/* Near misses kept in full; the rest are only counted */
+# define LAT_RECORDS 32
+
+/* Stack reserved for each philosopher coroutine (--engine=coro) */
+# define CORO_STACK_SIZE 65536
+/* Kernel mappings left to threads and libraries when guarding stacks */
+# define CORO_MAP_RESERVE 1024
+
+/* Per-philosopher event ring capacity, must be a power of two */
+# define LOG_RING_SIZE 512
+# define LOG_BUF_SIZE 65536
+/* Events younger than this many ms may still have older peers in flight */
+# define LOG_HOLD_MS 2
+/* Room for " <id> <status>\n" of one state, and for a whole log line */
+# define LOG_SUFFIX_SIZE 32
+# define LOG_LINE_SIZE 64
+/* --metrics=MS: room for one record, JSON keys included */
+# define METRICS_LINE_SIZE 256
+
+typedef enum e_state
+{
+	ST_FORK,
+	ST_EAT,
+	ST_SLEEP,
+	ST_THINK,
+	ST_DIED,
+	ST_COUNT
+}						t_state;
+
+typedef enum e_log_mode
+{
+	LOG_SYNC,
+	LOG_ASYNC,
+	LOG_NONE
+}						t_log_mode;
+
+typedef enum e_fork_mode
+{
+	FORKS_ORDERED,
+	FORKS_HYGIENIC
+}						t_fork_mode;
+
+typedef enum e_lock_mode
+{
+	LOCK_MUTEX,
+	LOCK_SPIN,
+	LOCK_FIFO
+}						t_lock_mode;
+
+/* Per-philosopher fork lock counters (--lock-stats) */
+typedef enum e_lock_stat
+{
+	LOCK_FAST,
+	LOCK_SPUN,
+	LOCK_PARKED,
+	LOCK_PARKS,
+	LOCK_SPINS,
+	LOCK_SWITCHES,
+	LOCK_STAT_COUNT
+}						t_lock_stat;
+
+typedef enum e_pin_mode
+{
+	PIN_NONE,
+	PIN_RR,
+	PIN_PACKED
+}						t_pin_mode;
+
+typedef enum e_think_mode
+{
+	THINK_ADAPTIVE,
+	THINK_FIXED
+}						t_think_mode;
+
+typedef enum e_huge_mode
+{
+	HUGE_OFF,
+	HUGE_THP,
+	HUGE_ON
+}						t_huge_mode;
+
+typedef enum e_engine_mode
+{
+	ENGINE_THREADS,
+	ENGINE_CORO,
+	ENGINE_DES
+}						t_engine_mode;
+
 typedef struct s_data	t_data;
+typedef struct s_philo	t_philo;
+typedef struct s_coro	t_coro;
+typedef struct s_worker	t_worker;
+
+typedef struct s_event
+{
+	long long			ts;
+	int					id;
+	int					state;
+}						t_event;
 
+/*
+** Single-producer single-consumer ring: the philosopher advances tail,
+** the log writer advances head. Indices grow freely and are masked.
+*/
+typedef struct s_ring
+{
+	atomic_uint			head;
+	atomic_uint			tail;
+	t_event				*slots;
+}						t_ring;
+
+typedef struct s_log
+{
+	t_ring				*rings;
+	t_philo				*philos;
+	int					ring_count;
+	pthread_t			writer;
+	int					started;
+	atomic_int			finished;
+	int					closed;
+	char				*buf;
+	int					len;
+	int					fd;
+	int					trace;
+	long long			last_ts;
+	atomic_llong		lines;
+}						t_log;
+
+/*
+** With threads the mutex is the fork itself. With coroutines it only
+** guards held and the FIFO of parked coroutines, so no worker thread
+** ever blocks on a fork for longer than a queue update.
+** With --forks=hygienic (Chandy-Misra) the mutex guards the fields
+** below it: owner is the id of the neighbour holding the fork, dirty
+** says it has been eaten with since it last changed hands, requested is
+** the id of the other neighbour waiting on cond for it (0 if none).
+** With --fork-lock=spin the fork is word instead (free, taken, taken
+** with sleepers), and spin_avg is the adaptive spin estimate. With
+** --fork-lock=fifo it is the ticket pair next and serving, and word
+** only says a waiter is parked on serving.
+*/
 typedef struct s_fork
 {
 	pthread_mutex_t		mutex;
 	int					id;
-}						t_fork;
+	int					held;
+	t_coro				*wait_head;
+	t_coro				*wait_tail;
+	pthread_cond_t		cond;
+	int					owner;
+	int					dirty;
+	int					requested;
+	int					in_use;
+	atomic_int			word;
+	atomic_int			spin_avg;
+	atomic_int			next;
+	atomic_int			serving;
+}	__attribute__((aligned(CACHE_LINE)))	t_fork;
+
+/*
+** Meal state the monitor scans, as a structure of arrays indexed by
+** id - 1: a sweep over N philosophers reads N / 8 (last_meal_time) or
+** N / 16 (eating, meals_eaten) cache lines instead of N scattered ones.
+** Each entry is written by its philosopher only twice per meal.
+*/
+typedef struct s_meals
+{
+	atomic_llong		*last_meal_time;
+	atomic_int			*eating;
+	atomic_int			*meals_eaten;
+}						t_meals;
 
+/*
+** Meal state is written only by the owning philosopher and read by the
+** monitor without locking: last_meal_time is published before eating is
+** raised, so a reader that sees eating == 0 never misses a newer meal.
+** The pointers lead into data->meals; the rest of the struct is touched
+** by its own thread only and sits on cache lines of its own.
+*/
 typedef struct s_philo
 {
 	int					id;
-	int					meals_eaten;
-	int					eating;
-	long long			last_meal_time;
+	atomic_int			*meals_eaten;
+	atomic_int			*eating;
+	atomic_llong		*last_meal_time;
+	long long			phase_end;
 	pthread_t			thread;
+	int					spawned;
+	t_coro				*coro;
 	t_fork				*left_fork;
 	t_fork				*right_fork;
-	pthread_mutex_t		meal_mutex;
+	t_fork				*first_fork;
+	t_fork				*second_fork;
+	char				*suffix;
+	unsigned char		suffix_len[ST_COUNT];
+	long long			lock_stats[LOCK_STAT_COUNT];
+	t_data				*data;
+}	__attribute__((aligned(CACHE_LINE)))	t_philo;
+
+/*
+** Min-heap of death deadlines owned by the monitor thread alone.
+*/
+typedef struct s_deadline
+{
+	long long			key;
+	int					idx;
+}						t_deadline;
+
+typedef struct s_deadlines
+{
+	t_deadline			*heap;
+	int					size;
+}						t_deadlines;
+
+/*
+** Log-linear histogram of µs values, filled concurrently with relaxed
+** adds and read once every thread has been joined.
+*/
+typedef struct s_hist
+{
+	atomic_llong		counts[LAT_BUCKETS];
+	atomic_llong		total;
+	atomic_llong		max;
+}						t_hist;
+
+/*
+** Times of one death or near miss, all in µs on the get_time_us clock.
+** detect is the monitor's check for a death and the meal start for a
+** near miss; print is when the line was written (or queued, --log=async).
+*/
+typedef struct s_lat_record
+{
+	long long			deadline;
+	long long			detect;
+	long long			print;
+	int					id;
+}						t_lat_record;
+
+/*
+** Instrumentation enabled by --latency=MS. lag is how late monitors run
+** their check after a deadline; slack is how much time a philosopher had
+** left when its next meal began. Slack under near_us is a near miss.
+*/
+typedef struct s_latency
+{
+	long long			near_us;
+	t_hist				lag;
+	t_hist				slack;
+	atomic_int			near_count;
+	t_lat_record		near[LAT_RECORDS];
+	t_lat_record		death;
+	int					died;
+}						t_latency;
+
+/*
+** Live metrics (--metrics=MS). Only the metrics thread touches this
+** after init: slack is its scratch array for the median, last_meals
+** and last_us the previous sample the meal rate is taken against.
+*/
+typedef struct s_metrics
+{
+	pthread_t			thread;
+	int					started;
+	int					interval_ms;
+	int					fd;
+	int					json;
+	long long			*slack;
+	long long			last_meals;
+	long long			last_us;
+}						t_metrics;
+
+/*
+** One metrics record. States are derived from the meal table and the
+** timings, so philosophers write nothing extra for them.
+*/
+typedef struct s_sample
+{
+	long long			t_ms;
+	long long			meals;
+	long long			per_s;
+	int					eating;
+	int					thinking;
+	int					sleeping;
+	long long			slack_min;
+	long long			slack_median;
+	long long			lines;
+}						t_sample;
+
+/*
+** One monitor thread, watching philosophers [first, first + count) with
+** its own deadline heap.
+*/
+typedef struct s_shard
+{
+	pthread_t			thread;
+	int					started;
+	int					first;
+	int					count;
+	t_deadlines			deadlines;
 	t_data				*data;
-}						t_philo;
+}	__attribute__((aligned(CACHE_LINE)))	t_shard;
+
+/*
+** One startup thread, creating philosophers [first, first + count).
+** status turns FAILURE if any of its pthread_create calls failed.
+*/
+typedef struct s_spawner
+{
+	pthread_t			thread;
+	int					first;
+	int					count;
+	int					status;
+	t_data				*data;
+}						t_spawner;
+
+/*
+** A philosopher run as a coroutine. worker is the thread currently (or
+** last) running it; next links it into a fork's wait queue; wake is its
+** key in the worker's timer heap.
+*/
+typedef struct s_coro
+{
+	ucontext_t			ctx;
+	t_philo				*philo;
+	t_worker			*worker;
+	t_coro				*next;
+	long long			wake;
+}						t_coro;
+
+/*
+** One OS thread of the coroutine engine. The run queue is shared (other
+** workers push wakeups and steal from it) and guarded by mutex; the
+** timer heap and the fields below it belong to the worker alone.
+*/
+typedef struct s_worker
+{
+	pthread_t			thread;
+	int					started;
+	pthread_mutex_t		mutex;
+	pthread_cond_t		cond;
+	t_coro				**runq;
+	int					head;
+	int					count;
+	t_coro				**timers;
+	int					ntimers;
+	ucontext_t			sched;
+	pthread_mutex_t		*unlock_after;
+	int					index;
+	t_data				*data;
+}						t_worker;
+
+typedef struct s_engine
+{
+	t_worker			*workers;
+	int					count;
+	t_coro				*coros;
+	char				*stacks;
+	size_t				guard;
+	size_t				stride;
+	atomic_int			finished;
+	atomic_int			stop;
+}						t_engine;
+
+/*
+** Discrete-event engine (--engine=des). Events are ordered by virtual
+** time in µs, then by kind (death checks run after philosopher events of
+** the same instant, as the monitor would see them), then by insertion.
+*/
+typedef enum e_des_kind
+{
+	DES_READY,
+	DES_GOT_FORK,
+	DES_EAT_END,
+	DES_SLEEP_END,
+	DES_DEATH
+}						t_des_kind;
+
+typedef struct s_des_event
+{
+	long long			time;
+	long long			seq;
+	int					philo;
+	t_des_kind			kind;
+}						t_des_event;
+
+/*
+** Virtual counterpart of t_philo. waiting is the fork index a queued
+** philosopher is waiting for (or was just handed); next links the queue.
+*/
+typedef struct s_des_philo
+{
+	long long			last_meal;
+	long long			phase_end;
+	int					meals;
+	int					eating;
+	int					first;
+	int					second;
+	int					waiting;
+	int					next;
+}						t_des_philo;
+
+typedef struct s_des
+{
+	t_des_event			*heap;
+	int					size;
+	long long			seq;
+	long long			now;
+	t_des_philo			*ph;
+	int					*owner;
+	int					*wait_head;
+	int					*wait_tail;
+	int					remaining;
+	int					stop;
+	char				*buf;
+	int					len;
+	long long			last_ts;
+	t_data				*data;
+}						t_des;
+
+/*
+** What a philosopher does at each step, bound once per run by
+** bind_actions from the engine, fork, lock, log and think options, so
+** the meal loop never tests a setting that cannot change mid-run.
+*/
+typedef struct s_actions
+{
+	int					(*acquire)(t_philo *, t_fork *, t_fork *);
+	void				(*take)(t_philo *, t_fork *);
+	void				(*drop)(t_philo *, t_fork *);
+	void				(*print)(t_philo *, t_state);
+	void				(*log)(t_philo *, t_state);
+	int					(*think)(t_philo *);
+}						t_actions;
+
+/*
+** One mapping holding every per-run array. next is bumped by arena_alloc;
+** map and map_size are what munmap needs back.
+*/
+typedef struct s_arena
+{
+	char				*map;
+	size_t				map_size;
+	char				*next;
+	char				*end;
+}						t_arena;
+
+/*
+** One scenario of a --batch file and, once a runner has run it, its
+** outcome: run status, id of the philosopher that died (0 if none) and
+** wall time. number is the line in the file, which names the output.
+*/
+typedef struct s_job
+{
+	char				*line;
+	int					number;
+	int					status;
+	int					died;
+	int					must_eat;
+	long long			wall_ms;
+}						t_job;
+
+/*
+** Runner threads claim jobs with one atomic increment of next until
+** none are left; each job gets a t_data of its own.
+*/
+typedef struct s_batch
+{
+	char				*text;
+	t_job				*jobs;
+	int					count;
+	atomic_int			next;
+	char				*out_dir;
+	int					runners;
+}						t_batch;
 
 typedef struct s_data
 {
@@ -61,17 +583,72 @@ typedef struct s_data
 	int					must_eat_count;
 	int					all_threads_ready;
 	int					simulation_stop;
+	int					died;
+	int					out_fd;
+	t_log_mode			log_mode;
+	int					log_set;
+	t_engine_mode		engine_mode;
+	t_fork_mode			fork_mode;
+	atomic_int			hygienic_stop;
+	t_think_mode		think_mode;
+	t_actions			act;
+	t_lock_mode			lock_mode;
+	int					lock_stats;
+	int					spin_max;
+	int					worker_count;
+	long long			until;
+	int					monitor_count;
+	int					stack_kb;
+	t_pin_mode			pin_mode;
+	t_huge_mode			huge_mode;
+	t_arena				arena;
+	int					monitor_cpu;
+	int					monitor_fifo;
+	int					*cpus;
+	int					cpu_count;
+	char				*trace_path;
+	int					trace_fd;
+	char				*shm_name;
+	t_shm_header		*shm;
+	t_shm_slot			*shm_slots;
+	size_t				shm_size;
+	t_shard				*shards;
+	atomic_int			meals_left;
+	int					near_ms;
+	t_latency			*latency;
+	t_metrics			metrics;
 	long long			start_time;
 	t_philo				*philosophers;
 	t_fork				*forks;
+	t_meals				meals;
+	char				*suffixes;
+	char				line[LOG_LINE_SIZE];
 	pthread_mutex_t		print_mutex;
 	pthread_mutex_t		state_mutex;
+	pthread_cond_t		stop_cond;
+	pthread_cond_t		start_cond;
+	pthread_attr_t		thread_attr;
+	t_log				log;
+	t_engine			engine;
 }						t_data;
 
 /* Init functions */
+int						run_simulation(t_data *data, int argc, char **argv);
+int						parse_options(t_data *data, int *argc, char **argv);
+char					*option_value(char *opt, char *name);
+int						apply_run_option(t_data *data, char *opt);
+int						apply_numeric_option(t_data *data, char *opt);
 int						init_data(t_data *data, int argc, char **argv);
 int						init_philosophers(t_data *data);
 int						init_forks(t_data *data);
+int						init_monotonic_cond(pthread_cond_t *cond);
+int						init_meals(t_data *data);
+size_t					line_round(size_t size);
+
+/* Per-run arena (--huge=off|thp|on) */
+int						arena_init(t_data *data);
+void					*arena_alloc(t_data *data, size_t size);
+void					arena_free(t_data *data);
 
 /* Thread and routine functions */
 int						create_threads(t_data *data);
@@ -86,22 +663,170 @@ int						philo_think(t_philo *philo);
 /* Helper functions for actions */
 void					setup_forks(t_philo *philo, t_fork **first,
 							t_fork **second);
-int						handle_single_philo(t_philo *philo, t_fork *first);
+void					philo_alone(t_philo *philo);
+int						ordered_acquire(t_philo *philo, t_fork *first,
+							t_fork *second);
+void					bind_actions(t_data *data);
 void					update_meal_status(t_philo *philo, int is_eating);
 
 /* Utils functions */
 int						ft_atoi(const char *str);
 int						ft_isdigit(int c);
+int						ft_strncmp(const char *s1, const char *s2, size_t n);
+int						ft_putstr_buf(char *dst, const char *src);
 long long				get_time(void);
-void					precise_sleep(long long time_in_ms);
+long long				get_time_us(void);
+int						sleep_until(t_data *data, long long deadline);
+void					precise_sleep(t_data *data, long long time_in_ms);
 int						interruptible_sleep(t_philo *philo,
 							long long time_in_ms);
-void					print_status(t_philo *philo, char *status);
+void					print_status(t_philo *philo, t_state state);
+int						announce_death(t_data *data, t_philo *philo);
+const char				*status_string(t_state state);
+
+/* Asynchronous logging */
+int						log_init(t_data *data);
+int						log_start(t_data *data);
+void					log_finish(t_data *data);
+void					log_push(t_ring *ring, t_event event);
+void					log_status(t_philo *philo, t_state state);
+void					log_flush(t_log *log, long long watermark);
+void					log_close(t_data *data);
+
+/* Execution engine: threads or coroutines behind one interface */
+int						engine_sleep_until(t_philo *philo, long long deadline);
+void					engine_pause(t_philo *philo, long long time_in_us);
+void					mutex_take(t_philo *philo, t_fork *fork);
+void					mutex_drop(t_philo *philo, t_fork *fork);
+
+/* Coroutine engine (--engine=coro) */
+int						coro_init(t_data *data);
+int						coro_start(t_data *data);
+int						coro_join(t_data *data);
+void					coro_free(t_data *data);
+int						coro_worker_count(t_data *data);
+int						coro_map_stacks(t_data *data);
+size_t					engine_arena_size(t_data *data);
+void					*coro_worker_main(void *arg);
+void					runq_push(t_worker *w, t_coro *co);
+t_coro					*runq_pop(t_worker *w);
+t_coro					*runq_steal(t_worker *thief);
+void					coro_wake_all(t_data *data);
+void					timer_push(t_worker *w, t_coro *co);
+t_coro					*timer_pop(t_worker *w);
+int						coro_sleep_until(t_philo *philo, long long deadline);
+void					coro_fork_take(t_philo *philo, t_fork *fork);
+void					coro_fork_drop(t_philo *philo, t_fork *fork);
+
+/* Discrete-event engine (--engine=des) */
+int						engine_run(t_data *data);
+int						des_run(t_data *data);
+void					des_push(t_des *des, int philo, t_des_kind kind,
+							long long time);
+t_des_event				des_pop(t_des *des);
+void					des_dispatch(t_des *des, t_des_event *ev);
+void					des_log(t_des *des, int philo, t_state state);
+void					des_fork_try(t_des *des, int philo, int fork);
+void					des_fork_drop(t_des *des, int fork);
+void					des_got_fork(t_des *des, int i);
+
+/* Spin-then-park fork lock (--fork-lock=spin|fifo, --lock-stats) */
+int						apply_lock_option(t_data *data, char *opt);
+int						fork_lock_init(t_data *data);
+void					fork_lock_take(t_philo *philo, t_fork *fork);
+void					spin_take(t_philo *philo, t_fork *fork);
+void					fifo_take(t_philo *philo, t_fork *fork);
+void					spin_drop(t_philo *philo, t_fork *fork);
+void					fifo_drop(t_philo *philo, t_fork *fork);
+int						spin_budget(t_philo *philo, t_fork *fork);
+void					spin_done(t_philo *philo, t_fork *fork, int rounds,
+							int won);
+void					cpu_relax(void);
+void					futex_wait(atomic_int *word, int value);
+void					futex_wake(atomic_int *word, int count);
+void					lock_stats_report(t_data *data);
+
+/* Chandy-Misra fork arbitration (--forks=hygienic) */
+int						hygienic_acquire(t_philo *philo, t_fork *first,
+							t_fork *second);
+void					hygienic_drop(t_philo *philo, t_fork *fork);
+void					hygienic_wake_all(t_data *data);
+
+/* Latency instrumentation (--latency=MS) */
+int						latency_init(t_data *data);
+void					latency_lag(t_data *data, long long key,
+							long long now_us);
+void					latency_meal(t_philo *philo, long long deadline);
+void					latency_death(t_data *data, t_philo *philo,
+							long long deadline, long long detect_us);
+void					latency_report(t_data *data);
+void					hist_add(t_hist *hist, long long value);
+void					hist_print(char *title, t_hist *hist);
+
+/* Thread startup (--stack=KB) */
+int						init_thread_attr(t_data *data);
+int						spawn_philosophers(t_data *data);
+
+/* Binary trace (--trace=FILE) */
+int						trace_open(t_data *data);
+int						trace_record(char *dst, long long *prev, t_event *ev);
+
+/* Live state table (--shm=NAME) */
+int						shm_init(t_data *data);
+void					shm_phase(t_data *data, int phase, int died);
+void					shm_publish(t_philo *philo, t_state state);
+void					shm_free(t_data *data);
+
+/* CPU placement (--pin, --monitor-cpu, --monitor-sched) */
+int						apply_affinity_option(t_data *data, char *opt);
+int						apply_think_option(t_data *data, char *opt);
+long long				think_until(t_data *data, long long sleep_end);
+int						think_fixed(t_philo *philo);
+int						think_adaptive(t_philo *philo);
+int						init_affinity(t_data *data);
+void					pin_philosopher(t_data *data, t_philo *philo);
+void					tune_monitor(t_data *data, pthread_t thread);
+
+/* Thread teardown */
+int						join_philosophers(t_data *data);
+int						abort_threads(t_data *data);
+
+/* Monitor shards (--monitors=N) */
+int						shard_count(t_data *data);
+int						init_shards(t_data *data);
+int						start_monitors(t_data *data);
+int						join_monitors(t_data *data);
+
+/* Monitor deadline heap */
+int						deadline_init(t_data *data, t_deadlines *dl, int count);
+void					deadline_reset(t_deadlines *dl, t_data *data, int first);
+void					deadline_rekey(t_deadlines *dl, long long key);
+
+/* Log line formatting */
+int						format_number(char *dst, long long n);
+void					init_suffixes(t_philo *philo, char *block);
+int						format_line(char *dst, t_philo *philo, long long ts,
+							t_state state);
 int						check_simulation_stop(t_philo *philo);
+void					set_simulation_stop(t_data *data);
+void					stop_all_fed(t_data *data);
+
+/* Live metrics (--metrics=MS) */
+int						apply_metrics_option(t_data *data, char *opt);
+int						metrics_init(t_data *data);
+int						metrics_start(t_data *data);
+int						metrics_join(t_data *data);
+void					metrics_emit(t_data *data);
+
+/* Batch mode (--batch=FILE) */
+int						batch_main(int argc, char **argv);
+int						batch_load(t_batch *batch, char *path);
+void					batch_run_job(t_batch *batch, t_job *job);
+int						batch_summary(t_batch *batch, long long wall_ms);
 
 /* Cleanup functions */
 void					free_data(t_data *data);
 
-void					wait_for_all_threads(t_philo *philo);
+void					wait_for_all_threads(t_data *data);
 
 #endif
@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shm_layout.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:05:12 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 00:05:12 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SHM_LAYOUT_H
+# define SHM_LAYOUT_H
+# include <stdatomic.h>
+# include <stdint.h>
+
+/*
+** Live state table published with --shm=NAME (POSIX shared memory).
+** Shared by philo, which writes it, and philo_watch, which reads it.
+*/
+# define SHM_MAGIC "PHSTATE1"
+# define SHM_VERSION 1
+
+/* Run phase, in t_shm_header.phase */
+# define SHM_STARTING 0
+# define SHM_RUNNING 1
+# define SHM_STOPPED 2
+
+/*
+** Fixed part, then header_size bytes in, count slots of slot_size bytes.
+** start_time is CLOCK_MONOTONIC in ms when the start gate opened (0
+** before), so a reader on the same host can tell how long ago
+** last_meal was. died is the id of the philosopher that starved, 0 if
+** none did.
+*/
+typedef struct s_shm_header
+{
+	char			magic[8];
+	uint32_t		version;
+	uint32_t		header_size;
+	uint32_t		slot_size;
+	uint32_t		count;
+	int32_t			time_to_die;
+	int32_t			time_to_eat;
+	int32_t			time_to_sleep;
+	int32_t			must_eat;
+	atomic_int		phase;
+	atomic_int		died;
+	atomic_llong	start_time;
+}	__attribute__((aligned(64)))	t_shm_header;
+
+/*
+** One philosopher, written only by its own thread (or coroutine) as a
+** seqlock: seq is odd while an update is in progress. state is a t_state
+** value (0 fork, 1 eating, 2 sleeping, 3 thinking), forks has bit 0 set
+** while the left fork (id - 1) is held and bit 1 for the right one (id %
+** count), last_meal is in ms since start_time.
+*/
+typedef struct s_shm_slot
+{
+	atomic_uint		seq;
+	atomic_int		state;
+	atomic_int		meals;
+	atomic_int		forks;
+	atomic_llong	last_meal;
+}	__attribute__((aligned(64)))	t_shm_slot;
+
+#endif
@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shm_publish.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:24:03 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 03:31:08 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name forks_after
+ * @brief Which forks the philosopher holds once this status is out
+ *
+ * @param philo Pointer to philosopher structure
+ * @param slot Its slot, holding the previous answer
+ * @param state Status being published
+ * @return int Bit 0 for the left fork, bit 1 for the right one
+ *
+ * Forks are taken first_fork then second_fork, so the first "has taken
+ * a fork" is the first fork and the next one the second. Both go back
+ * on the table before "is sleeping".
+ */
+static int	forks_after(t_philo *philo, t_shm_slot *slot, t_state state)
+{
+	int		held;
+
+	if (state == ST_EAT)
+		return (3);
+	if (state != ST_FORK)
+		return (0);
+	held = atomic_load_explicit(&slot->forks, memory_order_relaxed);
+	if (held == 0)
+		return (1 + (philo->first_fork != philo->left_fork));
+	return (held | (1 + (philo->second_fork != philo->left_fork)));
+}
+
+/**
+ * @name shm_publish
+ * @brief Updates the philosopher's slot in the live state table
+ *
+ * @param philo Pointer to philosopher structure
+ * @param state Status just reached
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ Seqlock, one writer per slot:                   │
+ * │                                                 │
+ * │ writer: seq = s + 1 (odd) → fence → fields      │
+ * │         → seq = s + 2 (release)                 │
+ * │ reader: s1 = seq (acquire) → fields → fence     │
+ * │         → s2 = seq; retry if s1 odd or s1 != s2 │
+ * │                                                 │
+ * │ No lock is shared with readers, so an observer  │
+ * │ sampling at any rate never slows the table down │
+ * └─────────────────────────────────────────────────┘
+ */
+void	shm_publish(t_philo *philo, t_state state)
+{
+	t_shm_slot		*slot;
+	unsigned int	seq;
+	int				forks;
+
+	slot = &philo->data->shm_slots[philo->id - 1];
+	forks = forks_after(philo, slot, state);
+	seq = atomic_load_explicit(&slot->seq, memory_order_relaxed);
+	atomic_store_explicit(&slot->seq, seq + 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+	atomic_store_explicit(&slot->state, state, memory_order_relaxed);
+	atomic_store_explicit(&slot->forks, forks, memory_order_relaxed);
+	atomic_store_explicit(&slot->meals, atomic_load_explicit(
+			philo->meals_eaten, memory_order_relaxed), memory_order_relaxed);
+	if (state == ST_EAT)
+		atomic_store_explicit(&slot->last_meal, atomic_load_explicit(
+				philo->last_meal_time, memory_order_relaxed)
+			- philo->data->start_time, memory_order_relaxed);
+	atomic_store_explicit(&slot->seq, seq + 2, memory_order_release);
+}
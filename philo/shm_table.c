@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shm_table.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:16:40 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 08:47:13 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name shm_fill
+ * @brief Writes the header and the initial slots of a new table
+ *
+ * @param data Pointer to main data structure
+ *
+ * The magic goes in last, after a release fence: a reader that sees it
+ * also sees the rest of the header.
+ */
+static void	shm_fill(t_data *data)
+{
+	t_shm_header	*hdr;
+	int				i;
+
+	hdr = data->shm;
+	hdr->version = SHM_VERSION;
+	hdr->header_size = sizeof(t_shm_header);
+	hdr->slot_size = sizeof(t_shm_slot);
+	hdr->count = data->num_philosophers;
+	hdr->time_to_die = data->time_to_die;
+	hdr->time_to_eat = data->time_to_eat;
+	hdr->time_to_sleep = data->time_to_sleep;
+	hdr->must_eat = data->must_eat_count;
+	data->shm_slots = (t_shm_slot *)((char *)hdr + sizeof(t_shm_header));
+	i = 0;
+	while (i < data->num_philosophers)
+	{
+		atomic_store_explicit(&data->shm_slots[i].state, ST_THINK,
+			memory_order_relaxed);
+		i++;
+	}
+	atomic_thread_fence(memory_order_release);
+	memcpy(hdr->magic, SHM_MAGIC, 8);
+}
+
+/**
+ * @name shm_map
+ * @brief Sizes the freshly opened table and maps it shared
+ *
+ * @param data Pointer to main data structure, shm_size set
+ * @param fd Descriptor from shm_open, closed here
+ * @return t_shm_header* The mapping, or NULL if it failed
+ */
+static t_shm_header	*shm_map(t_data *data, int fd)
+{
+	void	*map;
+
+	map = MAP_FAILED;
+	if (ftruncate(fd, data->shm_size) == 0)
+		map = mmap(NULL, data->shm_size, PROT_READ | PROT_WRITE,
+				MAP_SHARED, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return (NULL);
+	return (map);
+}
+
+/**
+ * @name shm_init
+ * @brief Creates and maps the --shm=NAME live state table
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if the table is mapped (or --shm is off), FAILURE
+ *             otherwise
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ /dev/shm/NAME                                   │
+ * │                                                 │
+ * │ t_shm_header   64 bytes (one cache line)        │
+ * │ t_shm_slot     64 bytes × N, one line each, so  │
+ * │                a philosopher's update never     │
+ * │                touches a neighbour's line       │
+ * └─────────────────────────────────────────────────┘
+ */
+int	shm_init(t_data *data)
+{
+	int	fd;
+
+	if (!data->shm_name)
+		return (SUCCESS);
+	if (data->engine_mode == ENGINE_DES)
+		return (dprintf(data->out_fd,
+				"Error: --shm needs real time, not --engine=des\n"), FAILURE);
+	data->shm_size = sizeof(t_shm_header)
+		+ sizeof(t_shm_slot) * (size_t)data->num_philosophers;
+	fd = shm_open(data->shm_name, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return (dprintf(data->out_fd, "Error: Cannot create %s\n",
+				data->shm_name), FAILURE);
+	data->shm = shm_map(data, fd);
+	if (!data->shm)
+	{
+		shm_unlink(data->shm_name);
+		return (dprintf(data->out_fd, "Error: Cannot map %s\n", data->shm_name),
+			FAILURE);
+	}
+	shm_fill(data);
+	return (SUCCESS);
+}
+
+/**
+ * @name shm_phase
+ * @brief Publishes a change of run phase
+ *
+ * @param data Pointer to main data structure
+ * @param phase SHM_RUNNING when the start gate opens, SHM_STOPPED at the
+ *              end of the run
+ * @param died Id of the philosopher that starved, 0 if not a death
+ */
+void	shm_phase(t_data *data, int phase, int died)
+{
+	if (!data->shm)
+		return ;
+	if (died)
+		atomic_store_explicit(&data->shm->died, died, memory_order_relaxed);
+	if (phase == SHM_RUNNING)
+		atomic_store_explicit(&data->shm->start_time, data->start_time,
+			memory_order_relaxed);
+	atomic_store_explicit(&data->shm->phase, phase, memory_order_release);
+}
+
+/**
+ * @name shm_free
+ * @brief Unmaps the table and removes its name
+ *
+ * @param data Pointer to main data structure
+ *
+ * Readers that still have it mapped keep the final state until they
+ * let go; the next run starts from a fresh table.
+ */
+void	shm_free(t_data *data)
+{
+	if (!data->shm)
+		return ;
+	munmap(data->shm, data->shm_size);
+	shm_unlink(data->shm_name);
+	data->shm = NULL;
+}
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simulation.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:11:37 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 08:47:13 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name setup_simulation
+ * @brief Builds every per-run structure once the arguments are parsed
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if the run is ready to start, FAILURE otherwise
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ 1. Thread attributes (--stack), CPU placement   │
+ * │    and the trace file                           │
+ * │ 2. The arena (--huge) all per-run arrays come   │
+ * │    from                                         │
+ * │ 3. Forks and their lock (--fork-lock),          │
+ * │    philosophers, log rings, the live            │
+ * │    state table, monitor shards, latency         │
+ * │    histograms and the coroutine engine          │
+ * │ 4. The philosophers' actions (bind_actions)     │
+ * └─────────────────────────────────────────────────┘
+ */
+static int	setup_simulation(t_data *data)
+{
+	if (init_thread_attr(data) == FAILURE || init_affinity(data) == FAILURE
+		|| trace_open(data) == FAILURE || arena_init(data) == FAILURE
+		|| init_forks(data) == FAILURE || fork_lock_init(data) == FAILURE
+		|| init_philosophers(data) == FAILURE
+		|| log_init(data) == FAILURE || shm_init(data) == FAILURE
+		|| init_shards(data) == FAILURE || latency_init(data) == FAILURE
+		|| metrics_init(data) == FAILURE || coro_init(data) == FAILURE)
+		return (FAILURE);
+	bind_actions(data);
+	return (SUCCESS);
+}
+
+/**
+ * @name run_simulation
+ * @brief Parses one argument set, runs it to the end and cleans up
+ *
+ * @param data Zeroed data structure with out_fd set by the caller
+ * @param argc Argument count, argv[0] included
+ * @param argv Argument values, compacted in place by parse_options
+ * @return int SUCCESS if the run completed, FAILURE otherwise
+ *
+ * main runs it once on stdout; --batch runs it on every scenario line,
+ * several at a time, each with a t_data and an output file of its own.
+ * Nothing it touches is shared between two runs.
+ */
+int	run_simulation(t_data *data, int argc, char **argv)
+{
+	if (parse_options(data, &argc, argv) == FAILURE
+		|| init_data(data, argc, argv) == FAILURE)
+		return (FAILURE);
+	if (setup_simulation(data) == FAILURE)
+	{
+		free_data(data);
+		return (FAILURE);
+	}
+	if (engine_run(data) == FAILURE)
+	{
+		dprintf(data->out_fd, "Error creating threads\n");
+		free_data(data);
+		return (FAILURE);
+	}
+	free_data(data);
+	return (SUCCESS);
+}
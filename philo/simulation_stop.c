@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simulation_stop.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:05:19 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/18 21:02:37 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name set_simulation_stop
+ * @brief Raises the stop flag and wakes every sleeper at once
+ *
+ * @param data Pointer to main data structure
+ *
+ * The caller must hold state_mutex. Sleepers block on stop_cond with
+ * that same mutex (see sleep_until), so the broadcast cannot be missed
+ * between their flag check and their wait. Parked coroutines are woken
+ * through their workers instead, hygienic fork waiters through their
+ * forks.
+ */
+void	set_simulation_stop(t_data *data)
+{
+	data->simulation_stop = 1;
+	pthread_cond_broadcast(&data->stop_cond);
+	if (data->engine_mode == ENGINE_CORO)
+		coro_wake_all(data);
+	if (data->fork_mode == FORKS_HYGIENIC)
+		hygienic_wake_all(data);
+}
+
+/**
+ * @name stop_all_fed
+ * @brief Ends the simulation once every philosopher has eaten enough
+ *
+ * @param data Pointer to main data structure
+ *
+ * Taken under print_mutex too, so no status line can follow the stop.
+ */
+void	stop_all_fed(t_data *data)
+{
+	pthread_mutex_lock(&data->print_mutex);
+	pthread_mutex_lock(&data->state_mutex);
+	set_simulation_stop(data);
+	pthread_mutex_unlock(&data->state_mutex);
+	pthread_mutex_unlock(&data->print_mutex);
+}
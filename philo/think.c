@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   think.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 03:52:14 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 08:47:13 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name set_think_mode
+ * @brief Selects how long philosophers think between nap and forks
+ *
+ * @param data Pointer to the main data structure
+ * @param value "adaptive" (until the table's next free slot, see
+ *              think_until) or "fixed" (a flat THINK_FIXED_US)
+ * @return int SUCCESS if the value is known, FAILURE otherwise
+ */
+static int	set_think_mode(t_data *data, char *value)
+{
+	if (ft_strncmp(value, "adaptive", 9) == 0)
+		data->think_mode = THINK_ADAPTIVE;
+	else if (ft_strncmp(value, "fixed", 6) == 0)
+		data->think_mode = THINK_FIXED;
+	else
+		return (dprintf(data->out_fd, "Error: Invalid think mode %s\n", value),
+			FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @name apply_think_option
+ * @brief Applies --think
+ *
+ * @param data Pointer to the main data structure
+ * @param opt Raw command-line word starting with "--"
+ * @return int SUCCESS if the option was applied, FAILURE if its value is
+ *             invalid, OPTION_UNKNOWN if it is another option
+ */
+int	apply_think_option(t_data *data, char *opt)
+{
+	char	*value;
+
+	value = option_value(opt, "--think");
+	if (value)
+		return (set_think_mode(data, value));
+	return (OPTION_UNKNOWN);
+}
+
+/**
+ * @name think_until
+ * @brief When a philosopher who just woke up should reach for its forks
+ *
+ * @param data Pointer to main data structure
+ * @param sleep_end End of its nap in µs; the meal started eat + sleep
+ *                  earlier
+ * @return long long Absolute wake-up time in µs, possibly already past
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ At most N/2 (rounded down) philosophers eat at  │
+ * │ once, so each gets a meal every N × eat / (N/2) │
+ * │ at best, and never faster than eat + sleep:     │
+ * │                                                 │
+ * │ period = max(N × eat / (N/2), eat + sleep)      │
+ * │ think  = period - eat - sleep                   │
+ * │                                                 │
+ * │ 5 800 200 200   → period 500, think 100 ms      │
+ * │ 4 410 200 200   → period 400, think 0           │
+ * │ 199 610 200 200 → period 402, think 2 ms        │
+ * │                                                 │
+ * │ Never later than THINK_MARGIN_US before the     │
+ * │ philosopher's own deadline (its slack)          │
+ * └─────────────────────────────────────────────────┘
+ */
+long long	think_until(t_data *data, long long sleep_end)
+{
+	long long	period;
+	long long	meal_start;
+	long long	wake;
+
+	period = data->time_to_eat * 1000LL;
+	if (data->num_philosophers > 1)
+		period = period * data->num_philosophers
+			/ (data->num_philosophers / 2);
+	if (period < (data->time_to_eat + data->time_to_sleep) * 1000LL)
+		period = (data->time_to_eat + data->time_to_sleep) * 1000LL;
+	meal_start = sleep_end
+		- (data->time_to_eat + data->time_to_sleep) * 1000LL;
+	wake = meal_start + period;
+	if (wake > meal_start + data->time_to_die * 1000LL - THINK_MARGIN_US)
+		wake = meal_start + data->time_to_die * 1000LL - THINK_MARGIN_US;
+	return (wake);
+}
+
+/**
+ * @name think_fixed
+ * @brief The think action for --think=fixed: a flat THINK_FIXED_US
+ *
+ * @param philo Thinking philosopher
+ * @return int SUCCESS always
+ */
+int	think_fixed(t_philo *philo)
+{
+	engine_pause(philo, THINK_FIXED_US);
+	return (SUCCESS);
+}
+
+/**
+ * @name think_adaptive
+ * @brief The think action for --think=adaptive (the default)
+ *
+ * @param philo Thinking philosopher, phase_end holding the end of its nap
+ * @return int SUCCESS once think_until is reached, FAILURE if the
+ *             simulation stopped meanwhile
+ */
+int	think_adaptive(t_philo *philo)
+{
+	return (engine_sleep_until(philo, think_until(philo->data,
+				philo->phase_end)));
+}
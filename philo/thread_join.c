@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   thread_join.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 06:21:37 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 06:21:37 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name join_philosophers
+ * @brief Waits for every philosopher thread that was created
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if every created thread was joined, FAILURE otherwise
+ */
+int	join_philosophers(t_data *data)
+{
+	int	status;
+	int	i;
+
+	status = SUCCESS;
+	i = 0;
+	while (data->engine_mode == ENGINE_THREADS && i < data->num_philosophers)
+	{
+		if (data->philosophers[i].spawned
+			&& pthread_join(data->philosophers[i].thread, NULL) != 0)
+			status = FAILURE;
+		i++;
+	}
+	return (status);
+}
+
+/**
+ * @name abort_threads
+ * @brief Winds down a run whose threads could not all be started
+ *
+ * @param data Pointer to main data structure
+ * @return int FAILURE always, for create_threads to return
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ 1. Raise the stop flag, then open the start     │
+ * │    gate: every thread already parked on it      │
+ * │    wakes, sees the stop and returns             │
+ * │ 2. Join whatever was created: workers,          │
+ * │    philosophers, monitors, log writer, metrics  │
+ * │                                                 │
+ * │ Only then may free_data unmap the arena those   │
+ * │ threads were still reading, which matters most  │
+ * │ under --batch, where the process lives on       │
+ * └─────────────────────────────────────────────────┘
+ */
+int	abort_threads(t_data *data)
+{
+	pthread_mutex_lock(&data->state_mutex);
+	set_simulation_stop(data);
+	data->all_threads_ready = 1;
+	pthread_cond_broadcast(&data->start_cond);
+	pthread_mutex_unlock(&data->state_mutex);
+	coro_join(data);
+	join_philosophers(data);
+	join_monitors(data);
+	log_finish(data);
+	if (data->metrics.started)
+		pthread_join(data->metrics.thread, NULL);
+	return (FAILURE);
+}
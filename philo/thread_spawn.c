@@ -0,0 +1,182 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   thread_spawn.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 21:14:08 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 08:47:13 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name init_thread_attr
+ * @brief Prepares the attributes every thread of the simulation gets
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if the attributes are usable, FAILURE otherwise
+ *
+ * Philosophers, monitors, workers and the log writer only keep a few
+ * frames on their stack, so --stack=KB (THREAD_STACK_KB by default)
+ * replaces the 8 MB default. Thousands of threads then fit in a few
+ * hundred MB of address space, and each mmap is cheaper.
+ */
+int	init_thread_attr(t_data *data)
+{
+	size_t	size;
+
+	if (pthread_attr_init(&data->thread_attr) != 0)
+		return (FAILURE);
+	if (data->stack_kb <= 0)
+		data->stack_kb = THREAD_STACK_KB;
+	size = (size_t)data->stack_kb * 1024;
+	if (size < (size_t)PTHREAD_STACK_MIN)
+		size = PTHREAD_STACK_MIN;
+	if (pthread_attr_setstacksize(&data->thread_attr, size) != 0)
+	{
+		dprintf(data->out_fd, "Error: Invalid stack size %d KB\n",
+			data->stack_kb);
+		return (FAILURE);
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @name spawner_count
+ * @brief Picks how many threads create the philosophers
+ *
+ * @param data Pointer to main data structure
+ * @return int One spawner per SPAWN_MIN_PHILOS philosophers, at most one
+ *             per core and at most SPAWN_MAX, at least one
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ N = 200,  4 cores → 1 (main thread spawns all)  │
+ * │ N = 5000, 4 cores → 4 spawners, 1250 each       │
+ * └─────────────────────────────────────────────────┘
+ */
+static int	spawner_count(t_data *data)
+{
+	long	count;
+	long	cores;
+
+	count = data->num_philosophers / SPAWN_MIN_PHILOS;
+	cores = sysconf(_SC_NPROCESSORS_ONLN);
+	if (cores > 0 && count > cores)
+		count = cores;
+	if (count > SPAWN_MAX)
+		count = SPAWN_MAX;
+	if (count < 1)
+		count = 1;
+	return (count);
+}
+
+/**
+ * @name spawn_range
+ * @brief Creates the philosopher threads of one spawner's range
+ *
+ * @param arg Void pointer to the t_spawner
+ * @return void* NULL
+ *
+ * Stops at the first failure; the caller sees it in status. Each new
+ * thread is placed right away (--pin), before the start gate opens.
+ */
+static void	*spawn_range(void *arg)
+{
+	t_spawner	*sp;
+	t_philo		*philo;
+	int			i;
+
+	sp = (t_spawner *)arg;
+	i = sp->first;
+	while (i < sp->first + sp->count)
+	{
+		philo = &sp->data->philosophers[i];
+		if (pthread_create(&philo->thread, &sp->data->thread_attr,
+				philosopher_routine, philo) != 0)
+		{
+			sp->status = FAILURE;
+			return (NULL);
+		}
+		philo->spawned = 1;
+		pin_philosopher(sp->data, philo);
+		i++;
+	}
+	return (NULL);
+}
+
+/**
+ * @name join_spawners
+ * @brief Waits for the spawners and collects their status
+ *
+ * @param sp Spawners
+ * @param count Number of spawners that were started
+ * @return int SUCCESS if every philosopher thread exists, FAILURE
+ *             otherwise
+ */
+static int	join_spawners(t_spawner *sp, int count)
+{
+	int	status;
+	int	k;
+
+	status = SUCCESS;
+	k = 0;
+	while (k < count)
+	{
+		if (pthread_join(sp[k].thread, NULL) != 0
+			|| sp[k].status == FAILURE)
+			status = FAILURE;
+		k++;
+	}
+	return (status);
+}
+
+/**
+ * @name spawn_philosophers
+ * @brief Creates every philosopher thread, several ranges in parallel
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if all threads were created, FAILURE otherwise
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ N = 5000, 4 spawners:                           │
+ * │                                                 │
+ * │ main ─┬─ spawner 0 → philosophers    0..1249    │
+ * │       ├─ spawner 1 → philosophers 1250..2499    │
+ * │       ├─ spawner 2 → philosophers 2500..3749    │
+ * │       └─ spawner 3 → philosophers 3750..4999    │
+ * │                                                 │
+ * │ Ranges split like monitor shards. With a single │
+ * │ spawner the main thread does the work itself.   │
+ * │ New threads block on the start gate, so they    │
+ * │ cost the spawners nothing while they wait       │
+ * └─────────────────────────────────────────────────┘
+ */
+int	spawn_philosophers(t_data *data)
+{
+	t_spawner	sp[SPAWN_MAX];
+	int			count;
+	int			k;
+
+	count = spawner_count(data);
+	k = 0;
+	while (k < count)
+	{
+		sp[k].first = k * (long)data->num_philosophers / count;
+		sp[k].count = (k + 1) * (long)data->num_philosophers / count
+			- sp[k].first;
+		sp[k].status = SUCCESS;
+		sp[k].data = data;
+		if (count == 1)
+			return (spawn_range(&sp[k]), sp[k].status);
+		if (pthread_create(&sp[k].thread, &data->thread_attr, spawn_range,
+				&sp[k]) != 0)
+			return (join_spawners(sp, k), FAILURE);
+		k++;
+	}
+	return (join_spawners(sp, count));
+}
@@ -6,80 +6,119 @@
 /*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/08 15:54:39 by mkurkar           #+#    #+#             */
-/*   Updated: 2025/06/16 10:31:28 by mkurkar          ###   ########.fr       */
+/*   Updated: 2026/10/18 15:32:08 by mkurkar          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "philosophers.h"
 
+/**
+ * @name get_time_us
+ * @brief Gets the current monotonic time in microseconds
+ *
+ * @return long long Microseconds since an arbitrary fixed point
+ *
+ * CLOCK_MONOTONIC never jumps with NTP or settimeofday, so deadlines
+ * computed from it stay valid for the whole run.
+ */
+long long	get_time_us(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((ts.tv_sec * 1000000LL) + (ts.tv_nsec / 1000));
+}
+
 /**
  * @name get_time
  * @brief Gets the current time in milliseconds
  *
- * @return long long Current time in milliseconds since epoch
+ * @return long long Current monotonic time in milliseconds
  *
  * Example:
  * ┌─────────────────────────────────────────────────┐
  * │ Time Calculation:                               │
  * │                                                 │
- * │ seconds × 1000 + microseconds ÷ 1000 = millisec │
+ * │ microseconds ÷ 1000 = milliseconds              │
  * │                                                 │
- * │ 1 second = 1000 milliseconds                    │
- * │ 1000 microseconds = 1 millisecond               │
+ * │ Same clock as get_time_us, so millisecond       │
+ * │ stamps and microsecond deadlines agree          │
  * └─────────────────────────────────────────────────┘
  */
 long long	get_time(void)
 {
-	struct timeval	tv;
-
-	gettimeofday(&tv, NULL);
-	return ((tv.tv_sec * 1000) + (tv.tv_usec / 1000));
+	return (get_time_us() / 1000);
 }
 
 /**
- * @name precise_sleep
- * @brief Sleeps for a specified amount of time with high precision
+ * @name sleep_until
+ * @brief Sleeps until an absolute monotonic deadline or simulation stop
  *
- * @param time_in_ms Time to sleep in milliseconds
+ * @param data Pointer to main data structure
+ * @param deadline Absolute wake-up time in microseconds (get_time_us)
+ * @return int SUCCESS at the deadline, FAILURE if the simulation stopped
  *
  * Example:
  * ┌─────────────────────────────────────────────────┐
- * │ Precision Sleep Implementation:                 │
+ * │ Two-Phase Sleep:                                │
  * │                                                 │
- * │ 1. Record start time                            │
- * │ 2. Loop until current_time - start ≥ target     │
- * │ 3. Small usleep(100) to avoid CPU hogging       │
+ * │ now ──── timed wait on stop_cond ────┬─ spin ─┐ │
+ * │               deadline - SLEEP_SPIN_US    deadline
  * │                                                 │
- * │ More precise than standard sleep functions      │
+ * │ 1. Block on stop_cond until deadline minus the  │
+ * │    spin margin; a stop broadcast wakes at once  │
+ * │ 2. Yield-spin the last stretch for sub-ms       │
+ * │    accuracy without a wakeup per 100 µs         │
  * └─────────────────────────────────────────────────┘
  */
-void	precise_sleep(long long time_in_ms)
+int	sleep_until(t_data *data, long long deadline)
 {
-	long long	start_time;
+	struct timespec	abs;
+	int				stop;
 
-	start_time = get_time();
-	while ((get_time() - start_time) < time_in_ms)
-		usleep(100);
+	abs.tv_sec = (deadline - SLEEP_SPIN_US) / 1000000;
+	abs.tv_nsec = ((deadline - SLEEP_SPIN_US) % 1000000) * 1000;
+	pthread_mutex_lock(&data->state_mutex);
+	while (!data->simulation_stop
+		&& get_time_us() < deadline - SLEEP_SPIN_US)
+		pthread_cond_timedwait(&data->stop_cond, &data->state_mutex, &abs);
+	stop = data->simulation_stop;
+	pthread_mutex_unlock(&data->state_mutex);
+	if (stop)
+		return (FAILURE);
+	while (get_time_us() < deadline)
+		sched_yield();
+	return (SUCCESS);
+}
+
+/**
+ * @name precise_sleep
+ * @brief Sleeps for a specified amount of time with high precision
+ *
+ * @param data Pointer to main data structure
+ * @param time_in_ms Time to sleep in milliseconds
+ *
+ * Returns early if the simulation stops meanwhile.
+ */
+void	precise_sleep(t_data *data, long long time_in_ms)
+{
+	sleep_until(data, get_time_us() + time_in_ms * 1000);
 }
 
 /**
  * @name interruptible_sleep
- * @brief Sleeps for a specified time but can be interrupted by simulation stop
+ * @brief Sleeps until a deadline relative to the current phase start
  *
  * @param philo Pointer to philosopher structure
- * @param time_in_ms Time to sleep in milliseconds
+ * @param time_in_ms Length of the phase in milliseconds
  * @return int SUCCESS if completed normally, FAILURE if interrupted
+ *
+ * The deadline is chained from the previous one (philo->phase_end), not
+ * from "now", so time spent printing or waking up never accumulates
+ * into drift across eat and sleep phases.
  */
 int	interruptible_sleep(t_philo *philo, long long time_in_ms)
 {
-	long long	start_time;
-
-	start_time = get_time();
-	while ((get_time() - start_time) < time_in_ms)
-	{
-		if (check_simulation_stop(philo))
-			return (FAILURE);
-		usleep(100);
-	}
-	return (SUCCESS);
+	philo->phase_end += time_in_ms * 1000;
+	return (engine_sleep_until(philo, philo->phase_end));
 }
@@ -0,0 +1,170 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:02:31 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 08:47:13 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philosophers.h"
+
+/**
+ * @name put_le
+ * @brief Stores the low bytes of a value, least significant first
+ *
+ * @param dst Destination buffer
+ * @param value Value to store
+ * @param bytes Number of bytes to write
+ *
+ * The file layout does not depend on the host's byte order, so traces
+ * decode anywhere.
+ */
+static void	put_le(char *dst, unsigned long long value, int bytes)
+{
+	int	i;
+
+	i = 0;
+	while (i < bytes)
+	{
+		dst[i] = (char)(value >> (8 * i));
+		i++;
+	}
+}
+
+/**
+ * @name put_record
+ * @brief Writes one fixed-width record
+ *
+ * @param dst Destination buffer, at least TRACE_REC_SIZE bytes
+ * @param delta Clock advance in ms; only the low 16 bits are kept
+ * @param word id << TRACE_STATE_BITS | kind
+ * @return int TRACE_REC_SIZE
+ */
+static int	put_record(char *dst, unsigned long long delta, unsigned int word)
+{
+	put_le(dst, delta & 0xFFFF, 2);
+	put_le(dst + 2, word, 4);
+	return (TRACE_REC_SIZE);
+}
+
+/**
+ * @name trace_record
+ * @brief Encodes an event relative to the previous one
+ *
+ * @param dst Destination buffer, at least 2 * TRACE_REC_SIZE bytes
+ * @param prev Timestamp of the previous record, updated
+ * @param ev Event to encode
+ * @return int Bytes written: TRACE_REC_SIZE, or twice that after a jump
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ 200 3 is eating   (prev 199)                    │
+ * │ → delta 1 | 3 << 3 | ST_EAT              6 bytes│
+ * │                                                 │
+ * │ 90000 3 died      (prev 200)                    │
+ * │ → TRACE_SKIP of 89800 ms: the low 16 bits in    │
+ * │   the delta field, the rest in place of the id  │
+ * │ → delta 0 | 3 << 3 | ST_DIED            12 bytes│
+ * │                                                 │
+ * │ The same text line takes 15 to 30 bytes         │
+ * └─────────────────────────────────────────────────┘
+ */
+int	trace_record(char *dst, long long *prev, t_event *ev)
+{
+	long long	delta;
+	int			len;
+
+	delta = ev->ts - *prev;
+	*prev = ev->ts;
+	len = 0;
+	if (delta < 0)
+		len = put_record(dst, -delta,
+				(unsigned int)(-delta >> 16) << TRACE_STATE_BITS | TRACE_BACK);
+	else if (delta > 0xFFFF)
+		len = put_record(dst, delta,
+				(unsigned int)(delta >> 16) << TRACE_STATE_BITS | TRACE_SKIP);
+	if (len)
+		delta = 0;
+	return (len + put_record(dst + len, delta,
+			(unsigned int)ev->id << TRACE_STATE_BITS | ev->state));
+}
+
+/**
+ * @name trace_header
+ * @brief Builds the header that opens every trace file
+ *
+ * @param data Pointer to main data structure
+ * @param hdr Destination, TRACE_HEADER_SIZE bytes
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ 0  "PHTRACE1"                                   │
+ * │ 8  philosophers   12 time_to_die                │
+ * │ 16 time_to_eat    20 time_to_sleep              │
+ * │ 24 must_eat (0xFFFFFFFF if not given)           │
+ * │ 28 record size (u16), engine (u8), 0 (u8)       │
+ * │                                                 │
+ * │ All fields little-endian; records follow        │
+ * └─────────────────────────────────────────────────┘
+ */
+static void	trace_header(t_data *data, char *hdr)
+{
+	memset(hdr, 0, TRACE_HEADER_SIZE);
+	memcpy(hdr, TRACE_MAGIC, 8);
+	put_le(hdr + 8, data->num_philosophers, 4);
+	put_le(hdr + 12, data->time_to_die, 4);
+	put_le(hdr + 16, data->time_to_eat, 4);
+	put_le(hdr + 20, data->time_to_sleep, 4);
+	put_le(hdr + 24, (unsigned int)data->must_eat_count, 4);
+	put_le(hdr + 28, TRACE_REC_SIZE, 2);
+	put_le(hdr + 30, data->engine_mode, 1);
+}
+
+/**
+ * @name trace_open
+ * @brief Points the log writer at data->out_fd, or creates the --trace file
+ *        and writes its header
+ *
+ * @param data Pointer to main data structure
+ * @return int SUCCESS if tracing is off or the file is ready, FAILURE
+ *             otherwise
+ *
+ * The threads and coroutine engines then log through the async rings:
+ * the writer thread merges them in time order, which is what the delta
+ * encoding needs, and encodes records instead of formatting text.
+ * Nothing goes to stdout; philo_trace turns the file back into text.
+ * An explicit --log=sync or --log=none contradicts that and is refused
+ * rather than silently overridden.
+ */
+int	trace_open(t_data *data)
+{
+	char	hdr[TRACE_HEADER_SIZE];
+
+	data->log.fd = data->out_fd;
+	if (!data->trace_path)
+		return (SUCCESS);
+	if (data->num_philosophers > TRACE_ID_MAX)
+		return (dprintf(data->out_fd,
+				"Error: Too many philosophers to trace\n"), FAILURE);
+	if (data->log_set && data->log_mode != LOG_ASYNC)
+		return (dprintf(data->out_fd, "Error: --trace needs --log=async\n"),
+			FAILURE);
+	if (data->engine_mode != ENGINE_DES)
+		data->log_mode = LOG_ASYNC;
+	data->trace_fd = open(data->trace_path, O_WRONLY | O_CREAT | O_TRUNC,
+			0644);
+	if (data->trace_fd < 0)
+		return (dprintf(data->out_fd, "Error: Cannot open %s\n",
+				data->trace_path), FAILURE);
+	data->log.fd = data->trace_fd;
+	data->log.trace = 1;
+	trace_header(data, hdr);
+	if (write(data->trace_fd, hdr, TRACE_HEADER_SIZE) != TRACE_HEADER_SIZE)
+		return (dprintf(data->out_fd, "Error: Cannot write %s\n",
+				data->trace_path), FAILURE);
+	return (SUCCESS);
+}
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   decode.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:20:12 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 08:03:27 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef DECODE_H
+# define DECODE_H
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include "../trace_layout.h"
+
+/* Records read per fread */
+# define TRACE_BLOCK_RECS 65536
+
+/*
+** Run parameters from the header. must is -1 when no must_eat argument
+** was given.
+*/
+typedef struct s_header
+{
+	unsigned int	n;
+	unsigned int	die;
+	unsigned int	eat;
+	unsigned int	sleep;
+	int				must;
+	unsigned int	rec_size;
+	unsigned int	engine;
+}					t_header;
+
+/*
+** What to print: id 0 keeps every philosopher; from and to bound the
+** timestamps, inclusive. ts is the clock rebuilt from the deltas.
+*/
+typedef struct s_decoder
+{
+	unsigned int	id;
+	long long		from;
+	long long		to;
+	int				info;
+	long long		ts;
+	long long		events;
+	long long		printed;
+	FILE			*out;
+}					t_decoder;
+
+int					read_header(FILE *in, t_header *hdr);
+int					decode_stream(FILE *in, t_decoder *dec);
+
+#endif
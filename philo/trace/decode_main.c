@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   decode_main.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:31:09 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/18 23:31:09 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "decode.h"
+
+/**
+ * @name parse_filter
+ * @brief Applies one "--name=value" option to the decoder
+ *
+ * @param dec Decoder to configure
+ * @param opt Raw command-line word
+ * @return int 0 if the option is known, 1 otherwise
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ --id=N     only philosopher N                   │
+ * │ --from=MS  only events stamped at or after MS   │
+ * │ --to=MS    only events stamped at or before MS  │
+ * │ --info     run parameters and counts, no lines  │
+ * └─────────────────────────────────────────────────┘
+ */
+static int	parse_filter(t_decoder *dec, char *opt)
+{
+	if (strncmp(opt, "--id=", 5) == 0)
+		dec->id = strtoul(opt + 5, NULL, 10);
+	else if (strncmp(opt, "--from=", 7) == 0)
+		dec->from = strtoll(opt + 7, NULL, 10);
+	else if (strncmp(opt, "--to=", 5) == 0)
+		dec->to = strtoll(opt + 5, NULL, 10);
+	else if (strcmp(opt, "--info") == 0)
+		dec->info = 1;
+	else
+		return (fprintf(stderr, "philo_trace: unknown option %s\n", opt), 1);
+	return (0);
+}
+
+/**
+ * @name print_info
+ * @brief Prints the run parameters and how many events matched
+ *
+ * @param hdr Header of the trace
+ * @param dec Decoder after the whole file was read
+ */
+static void	print_info(t_header *hdr, t_decoder *dec)
+{
+	static const char	*engines[] = {"threads", "coro", "des", "?"};
+
+	if (hdr->engine > 3)
+		hdr->engine = 3;
+	printf("philosophers %u  die %u  eat %u  sleep %u  must %d  "
+		"engine %s\n", hdr->n, hdr->die, hdr->eat, hdr->sleep, hdr->must,
+		engines[hdr->engine]);
+	printf("events %lld  matched %lld  last %lld ms\n", dec->events,
+		dec->printed, dec->ts);
+}
+
+/**
+ * @name decode_file
+ * @brief Decodes one trace file to stdout
+ *
+ * @param path Trace file written by philo --trace=FILE
+ * @param dec Configured decoder
+ * @return int 0 on success, 1 on failure
+ */
+static int	decode_file(char *path, t_decoder *dec)
+{
+	static char	obuf[1 << 16];
+	t_header	hdr;
+	FILE		*in;
+	int			status;
+
+	in = fopen(path, "rb");
+	if (!in)
+		return (fprintf(stderr, "philo_trace: cannot open %s\n", path), 1);
+	status = read_header(in, &hdr);
+	dec->out = NULL;
+	if (!dec->info)
+		dec->out = stdout;
+	setvbuf(stdout, obuf, _IOFBF, sizeof(obuf));
+	if (status == 0)
+		status = decode_stream(in, dec);
+	if (status == 0 && dec->info)
+		print_info(&hdr, dec);
+	fclose(in);
+	fflush(stdout);
+	return (status);
+}
+
+/**
+ * @name main
+ * @brief Entry point of the trace decoder
+ *
+ * @param argc Number of command-line arguments
+ * @param argv Array of command-line arguments
+ * @return int 0 on success, 1 on failure
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ ./philo 5 800 200 200 --trace=run.bin           │
+ * │ ./philo_trace run.bin                           │
+ * │     the exact lines philo would have printed    │
+ * │ ./philo_trace run.bin --id=3 --from=1000        │
+ * │     philosopher 3, from 1 s on                  │
+ * └─────────────────────────────────────────────────┘
+ */
+int	main(int argc, char **argv)
+{
+	t_decoder	dec;
+	char		*path;
+	int			i;
+
+	memset(&dec, 0, sizeof(dec));
+	dec.to = __LONG_LONG_MAX__;
+	path = NULL;
+	i = 1;
+	while (i < argc)
+	{
+		if (strncmp(argv[i], "--", 2) != 0 && !path)
+			path = argv[i];
+		else if (parse_filter(&dec, argv[i]) != 0)
+			return (1);
+		i++;
+	}
+	if (!path)
+		return (fprintf(stderr, "usage: %s <trace> [--id=N] [--from=MS] "
+				"[--to=MS] [--info]\n", argv[0]), 1);
+	return (decode_file(path, &dec));
+}
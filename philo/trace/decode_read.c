@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   decode_read.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:24:47 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/18 23:24:47 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "decode.h"
+
+/**
+ * @name get_le
+ * @brief Reads a little-endian unsigned number
+ *
+ * @param src First byte
+ * @param bytes Width of the number
+ * @return unsigned long long The number
+ */
+static unsigned long long	get_le(const unsigned char *src, int bytes)
+{
+	unsigned long long	value;
+
+	value = 0;
+	while (bytes > 0)
+	{
+		bytes--;
+		value = value << 8 | src[bytes];
+	}
+	return (value);
+}
+
+/**
+ * @name read_header
+ * @brief Checks and parses the header of a trace file
+ *
+ * @param in Trace file, at offset 0
+ * @param hdr Output run parameters
+ * @return int 0 if the file is a trace we can read, 1 otherwise
+ */
+int	read_header(FILE *in, t_header *hdr)
+{
+	unsigned char	raw[TRACE_HEADER_SIZE];
+
+	if (fread(raw, 1, TRACE_HEADER_SIZE, in) != TRACE_HEADER_SIZE
+		|| memcmp(raw, TRACE_MAGIC, 8) != 0)
+		return (fprintf(stderr, "philo_trace: not a philo trace\n"), 1);
+	hdr->n = get_le(raw + 8, 4);
+	hdr->die = get_le(raw + 12, 4);
+	hdr->eat = get_le(raw + 16, 4);
+	hdr->sleep = get_le(raw + 20, 4);
+	hdr->must = (int)get_le(raw + 24, 4);
+	hdr->rec_size = get_le(raw + 28, 2);
+	hdr->engine = get_le(raw + 30, 1);
+	if (hdr->rec_size != TRACE_REC_SIZE)
+		return (fprintf(stderr, "philo_trace: unknown record size %u\n",
+				hdr->rec_size), 1);
+	return (0);
+}
+
+/**
+ * @name status_text
+ * @brief Returns the log text of a t_state value
+ *
+ * @param kind Record kind below TRACE_SKIP
+ * @return const char* Same strings as philo's status_string
+ */
+static const char	*status_text(unsigned int kind)
+{
+	static const char	*text[] = {"has taken a fork", "is eating",
+		"is sleeping", "is thinking", "died", "?"};
+
+	if (kind > 5)
+		kind = 5;
+	return (text[kind]);
+}
+
+/**
+ * @name decode_record
+ * @brief Advances the clock by one record and prints it if it matches
+ *
+ * @param dec Decoder state and filter
+ * @param rec TRACE_REC_SIZE bytes
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ delta 1, word 3 << 3 | 1   → ts += 1            │
+ * │                              "200 3 is eating"  │
+ * │ delta d, word h << 3 | 6   → ts += h << 16 | d  │
+ * │ delta d, word h << 3 | 7   → ts -= h << 16 | d  │
+ * └─────────────────────────────────────────────────┘
+ */
+static void	decode_record(t_decoder *dec, const unsigned char *rec)
+{
+	unsigned long long	delta;
+	unsigned long long	word;
+	unsigned int		kind;
+
+	delta = get_le(rec, 2);
+	word = get_le(rec + 2, 4);
+	kind = word & TRACE_STATE_MASK;
+	word >>= TRACE_STATE_BITS;
+	if (kind == TRACE_SKIP)
+		dec->ts += (long long)(word << 16 | delta);
+	else if (kind == TRACE_BACK)
+		dec->ts -= (long long)(word << 16 | delta);
+	if (kind == TRACE_SKIP || kind == TRACE_BACK)
+		return ;
+	dec->ts += delta;
+	dec->events++;
+	if ((dec->id && word != dec->id) || dec->ts < dec->from
+		|| dec->ts > dec->to)
+		return ;
+	if (dec->out)
+		fprintf(dec->out, "%lld %llu %s\n", dec->ts, word,
+			status_text(kind));
+	dec->printed++;
+}
+
+/**
+ * @name decode_stream
+ * @brief Decodes every record after the header
+ *
+ * @param in Trace file, just past the header
+ * @param dec Decoder state and filter
+ * @return int 0 on success, 1 if the file ends inside a record
+ *
+ * Records are read TRACE_BLOCK_RECS at a time; output goes through
+ * stdio's buffer, so a multi-gigabyte text log costs no syscall per line.
+ */
+int	decode_stream(FILE *in, t_decoder *dec)
+{
+	unsigned char	*block;
+	size_t			got;
+	size_t			i;
+
+	block = malloc(TRACE_REC_SIZE * TRACE_BLOCK_RECS);
+	if (!block)
+		return (fprintf(stderr, "philo_trace: out of memory\n"), 1);
+	got = fread(block, 1, TRACE_REC_SIZE * TRACE_BLOCK_RECS, in);
+	while (got >= TRACE_REC_SIZE)
+	{
+		i = 0;
+		while (i + TRACE_REC_SIZE <= got)
+		{
+			decode_record(dec, block + i);
+			i += TRACE_REC_SIZE;
+		}
+		if (got % TRACE_REC_SIZE)
+			break ;
+		got = fread(block, 1, TRACE_REC_SIZE * TRACE_BLOCK_RECS, in);
+	}
+	free(block);
+	if (got % TRACE_REC_SIZE)
+		return (fprintf(stderr, "philo_trace: truncated record\n"), 1);
+	return (0);
+}
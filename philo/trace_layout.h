@@ -0,0 +1,36 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_layout.h                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 08:03:27 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 08:03:27 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TRACE_LAYOUT_H
+# define TRACE_LAYOUT_H
+
+/*
+** Binary trace (--trace=FILE). Shared by philo, which writes it, and
+** philo_trace, which decodes it: a TRACE_HEADER_SIZE header, then
+** 6-byte records of a 16-bit ms delta and a 32-bit word holding
+** id << TRACE_STATE_BITS | state.
+*/
+# define TRACE_MAGIC "PHTRACE1"
+# define TRACE_HEADER_SIZE 32
+# define TRACE_REC_SIZE 6
+# define TRACE_STATE_BITS 3
+# define TRACE_STATE_MASK 7
+# define TRACE_ID_MAX 536870911
+
+/*
+** Record kinds beyond t_state: the clock moves by a delta too large for
+** 16 bits, forward or (rarely, async merge) backward; nothing happens.
+*/
+# define TRACE_SKIP 6
+# define TRACE_BACK 7
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/08 15:55:48 by mkurkar           #+#    #+#             */
-/*   Updated: 2025/06/16 10:31:32 by mkurkar          ###   ########.fr       */
+/*   Updated: 2026/10/19 07:34:40 by mkurkar          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,7 +17,11 @@
  * @brief Prints the status of a philosopher with timestamp
  *
  * @param philo Pointer to philosopher structure
- * @param status Status message to print
+ * @param state State whose message is printed
+ *
+ * The log action for --log=sync; callers go through act.print, which
+ * is bound to log_status for --log=async, to nothing for --log=none
+ * and, with --shm, to a publish in the live table first.
  *
  * Example:
  * ┌─────────────────────────────────────────────────┐
@@ -30,16 +34,19 @@
  * │          └─────── Timestamp (in milliseconds)   │
  * └─────────────────────────────────────────────────┘
  */
-void	print_status(t_philo *philo, char *status)
+void	print_status(t_philo *philo, t_state state)
 {
-	long long	current_time;
+	int	len;
 
 	pthread_mutex_lock(&philo->data->print_mutex);
 	pthread_mutex_lock(&philo->data->state_mutex);
 	if (!philo->data->simulation_stop)
 	{
-		current_time = get_time() - philo->data->start_time;
-		printf("%lld %d %s\n", current_time, philo->id, status);
+		len = format_line(philo->data->line, philo,
+				get_time() - philo->data->start_time, state);
+		write(philo->data->out_fd, philo->data->line, len);
+		atomic_fetch_add_explicit(&philo->data->log.lines, 1,
+			memory_order_relaxed);
 	}
 	pthread_mutex_unlock(&philo->data->state_mutex);
 	pthread_mutex_unlock(&philo->data->print_mutex);
@@ -55,25 +62,27 @@ void	print_status(t_philo *philo, char *status)
  * ┌─────────────────────────────────────────────────┐
  * │ Memory Management Flow:                         │
  * │                                                 │
- * │ 1. Check if forks exist → Free them             │
- * │ 2. Check if philosophers exist → Free them      │
+ * │ 1. Close the trace file                         │
+ * │ 2. Release the coroutine engine, the thread     │
+ * │    attributes, the CPU list and the live state  │
+ * │    table                                        │
+ * │ 3. Unmap the arena: forks, philosophers, log    │
+ * │    suffixes, meal table, shards, async rings    │
+ * │    all go with one call                         │
  * │                                                 │
- * │ Note: Sets pointers to NULL after freeing       │
+ * │ Note: Pointers into the arena are set to NULL   │
  * │ to prevent use-after-free bugs.                 │
  * └─────────────────────────────────────────────────┘
  */
 void	free_data(t_data *data)
 {
-	if (data->forks)
-	{
-		free(data->forks);
-		data->forks = NULL;
-	}
-	if (data->philosophers)
-	{
-		free(data->philosophers);
-		data->philosophers = NULL;
-	}
+	log_close(data);
+	coro_free(data);
+	pthread_attr_destroy(&data->thread_attr);
+	free(data->cpus);
+	data->cpus = NULL;
+	shm_free(data);
+	arena_free(data);
 }
 
 /**
@@ -88,7 +97,7 @@ void	free_data(t_data *data)
  * │ Sleeping Process:                               │
  * │                                                 │
  * │ 1. Print sleeping status                        │
- * │ 2. Sleep for time_to_sleep milliseconds         │
+ * │ 2. Sleep until meal end + time_to_sleep         │
  * │ 3. Return success                               │
  * │                                                 │
  * │ This simulates the philosopher resting          │
@@ -98,7 +107,7 @@ int	philo_sleep(t_philo *philo)
 {
 	if (check_simulation_stop(philo))
 		return (FAILURE);
-	print_status(philo, "is sleeping");
+	philo->data->act.print(philo, ST_SLEEP);
 	if (interruptible_sleep(philo, philo->data->time_to_sleep) == FAILURE)
 		return (FAILURE);
 	return (SUCCESS);
@@ -109,15 +118,18 @@ int	philo_sleep(t_philo *philo)
  * @brief Handles the thinking action of a philosopher
  *
  * @param philo Pointer to philosopher structure
- * @return int SUCCESS always
+ * @return int SUCCESS if thinking completed, FAILURE otherwise
  *
  * Example:
  * ┌─────────────────────────────────────────────────┐
  * │ Thinking Process:                               │
  * │                                                 │
  * │ 1. Print thinking status                        │
- * │ 2. Brief pause (usleep 500 microseconds)        │
- * │ 3. Return success                               │
+ * │ 2. Run the think action: think_adaptive waits   │
+ * │    for the next free slot at the table,         │
+ * │    think_fixed pauses 500 µs                    │
+ * │ 3. Return success, or failure if the simulation │
+ * │    stopped meanwhile                            │
  * │                                                 │
  * │ This simulates the philosopher contemplating    │
  * └─────────────────────────────────────────────────┘
@@ -131,9 +143,8 @@ int	philo_think(t_philo *philo)
 		return (FAILURE);
 	}
 	pthread_mutex_unlock(&philo->data->state_mutex);
-	print_status(philo, "is thinking");
-	usleep(500);
-	return (SUCCESS);
+	philo->data->act.print(philo, ST_THINK);
+	return (philo->data->act.think(philo));
 }
 
 /**
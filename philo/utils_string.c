@@ -6,7 +6,7 @@
 /*   By: mkurkar <mkurkar@student.42amman.com>      +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/08 15:53:29 by mkurkar           #+#    #+#             */
-/*   Updated: 2025/05/25 16:00:04 by mkurkar          ###   ########.fr       */
+/*   Updated: 2026/10/18 11:34:02 by mkurkar          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -52,3 +52,47 @@ int	ft_atoi(const char *str)
 	}
 	return (res * sign);
 }
+
+/**
+ * @name ft_strncmp
+ * @brief Compares at most n characters of two strings
+ *
+ * @param s1 First string
+ * @param s2 Second string
+ * @param n Maximum number of characters to compare
+ * @return int Difference of the first mismatching bytes, 0 if equal
+ */
+int	ft_strncmp(const char *s1, const char *s2, size_t n)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < n && (s1[i] || s2[i]))
+	{
+		if (s1[i] != s2[i])
+			return ((unsigned char)s1[i] - (unsigned char)s2[i]);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @name ft_putstr_buf
+ * @brief Copies a string into dst without its terminator
+ *
+ * @param dst Destination buffer
+ * @param src String to copy
+ * @return int Number of characters written
+ */
+int	ft_putstr_buf(char *dst, const char *src)
+{
+	int	i;
+
+	i = 0;
+	while (src[i])
+	{
+		dst[i] = src[i];
+		i++;
+	}
+	return (i);
+}
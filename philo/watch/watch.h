@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   watch.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:41:27 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 00:41:27 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef WATCH_H
+# define WATCH_H
+
+# include <fcntl.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <time.h>
+# include <unistd.h>
+# include "../shm_layout.h"
+
+/* How long philo_watch waits for philo to create the table, in ms */
+# define WATCH_ATTACH_MS 5000
+
+/*
+** A mapped table. Read-only: nothing a reader does can disturb the run.
+*/
+typedef struct s_view
+{
+	t_shm_header	*hdr;
+	t_shm_slot		*slots;
+	size_t			size;
+}					t_view;
+
+/* One consistent copy of a slot */
+typedef struct s_sample
+{
+	int				state;
+	int				meals;
+	int				forks;
+	long long		last_meal;
+}					t_sample;
+
+typedef enum e_watch_format
+{
+	WATCH_SUMMARY,
+	WATCH_FULL,
+	WATCH_JSON
+}					t_watch_format;
+
+/* Reading, usable on its own by other observers */
+int					state_attach(const char *name, t_view *view);
+void				state_detach(t_view *view);
+void				state_read_slot(t_shm_slot *slot, t_sample *out);
+long long			state_now(t_view *view);
+
+/* Printing */
+void				print_summary(t_view *view, t_sample *s, long long now);
+void				print_full(t_view *view, t_sample *s, long long now);
+void				print_json(t_view *view, t_sample *s, long long now);
+
+#endif
@@ -0,0 +1,164 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   watch_main.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:04:38 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 01:04:38 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "watch.h"
+
+/**
+ * @name sleep_ms
+ * @brief Sleeps for a number of milliseconds
+ *
+ * @param ms Duration
+ */
+static void	sleep_ms(long long ms)
+{
+	struct timespec	ts;
+
+	ts.tv_sec = ms / 1000;
+	ts.tv_nsec = (ms % 1000) * 1000000;
+	nanosleep(&ts, NULL);
+}
+
+/**
+ * @name attach_wait
+ * @brief Attaches to the table, waiting for philo to create it
+ *
+ * @param name Name given to philo with --shm=NAME
+ * @param view Output mapping
+ * @return int 0 on success, 1 after WATCH_ATTACH_MS without a table
+ *
+ * Starting the watcher first and philo second is fine.
+ */
+static int	attach_wait(char *name, t_view *view)
+{
+	int	waited;
+
+	waited = 0;
+	while (state_attach(name, view) != 0)
+	{
+		if (waited >= WATCH_ATTACH_MS)
+			return (fprintf(stderr, "philo_watch: no table %s\n", name), 1);
+		sleep_ms(10);
+		waited += 10;
+	}
+	return (0);
+}
+
+/**
+ * @name sample_once
+ * @brief Copies every slot and prints them in the chosen format
+ *
+ * @param view Mapped table
+ * @param s Room for one sample per philosopher
+ * @param format Output format
+ * @return int 1 once philo has marked the run stopped, 0 otherwise
+ *
+ * The phase is read before the slots, so the sample that reports
+ * "stopped" holds the final state.
+ */
+static int	sample_once(t_view *view, t_sample *s, t_watch_format format)
+{
+	unsigned int	i;
+	long long		now;
+	int				stopped;
+
+	stopped = (atomic_load_explicit(&view->hdr->phase, memory_order_acquire)
+			== SHM_STOPPED);
+	now = state_now(view);
+	i = 0;
+	while (i < view->hdr->count)
+	{
+		state_read_slot(&view->slots[i], &s[i]);
+		i++;
+	}
+	if (format == WATCH_JSON)
+		print_json(view, s, now);
+	else if (format == WATCH_FULL)
+		print_full(view, s, now);
+	else
+		print_summary(view, s, now);
+	fflush(stdout);
+	return (stopped);
+}
+
+/**
+ * @name parse_args
+ * @brief Reads the command line
+ *
+ * @param argv Arguments; argv[1] is the table name
+ * @param hz Output, samples per second
+ * @param format Output format
+ * @return int 0 if every argument is known, 1 otherwise
+ */
+static int	parse_args(char **argv, int *hz, t_watch_format *format)
+{
+	int	i;
+
+	i = 2;
+	while (argv[i])
+	{
+		if (strncmp(argv[i], "--hz=", 5) == 0)
+			*hz = atoi(argv[i] + 5);
+		else if (strcmp(argv[i], "--full") == 0)
+			*format = WATCH_FULL;
+		else if (strcmp(argv[i], "--json") == 0)
+			*format = WATCH_JSON;
+		else
+			return (fprintf(stderr, "philo_watch: unknown option %s\n",
+					argv[i]), 1);
+		i++;
+	}
+	if (*hz <= 0 || *hz > 1000)
+		return (fprintf(stderr, "philo_watch: --hz must be 1 to 1000\n"), 1);
+	return (0);
+}
+
+/**
+ * @name main
+ * @brief Entry point of the live state reader
+ *
+ * @param argc Number of command-line arguments
+ * @param argv Array of command-line arguments
+ * @return int 0 on success, 1 on failure
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ ./philo 200 800 200 200 --shm=/dinner --log=none│
+ * │ ./philo_watch /dinner --hz=20                   │
+ * │     a summary line 20 times per second until    │
+ * │     the run stops; --full for one line per      │
+ * │     philosopher, --json for dashboards          │
+ * └─────────────────────────────────────────────────┘
+ */
+int	main(int argc, char **argv)
+{
+	t_view			view;
+	t_sample		*s;
+	t_watch_format	format;
+	int				hz;
+
+	hz = 10;
+	format = WATCH_SUMMARY;
+	if (argc < 2 || argv[1][0] == '-')
+		return (fprintf(stderr, "usage: %s <name> [--hz=N] [--full|--json]"
+				"\n", argv[0]), 1);
+	if (parse_args(argv, &hz, &format) != 0
+		|| attach_wait(argv[1], &view) != 0)
+		return (1);
+	s = malloc(sizeof(t_sample) * view.hdr->count);
+	if (!s)
+		return (state_detach(&view), 1);
+	while (sample_once(&view, s, format) == 0)
+		sleep_ms(1000 / hz);
+	free(s);
+	state_detach(&view);
+	return (0);
+}
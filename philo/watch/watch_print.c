@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   watch_print.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:55:14 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 00:55:14 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "watch.h"
+
+/**
+ * @name state_name
+ * @brief Short name of a slot state, or of the run phase
+ *
+ * @param view Mapped table
+ * @param id Philosopher id
+ * @param state Slot state (t_state value)
+ * @return const char* "fork", "eating", "sleeping", "thinking" or "died"
+ */
+static const char	*state_name(t_view *view, unsigned int id, int state)
+{
+	static const char	*names[] = {"fork", "eating", "sleeping",
+		"thinking", "died"};
+
+	if (atomic_load_explicit(&view->hdr->died, memory_order_relaxed)
+		== (int)id)
+		return ("died");
+	if (state < 0 || state > 4)
+		state = 3;
+	return (names[state]);
+}
+
+/**
+ * @name phase_name
+ * @brief Name of the run phase
+ *
+ * @param view Mapped table
+ * @return const char* "starting", "running" or "stopped"
+ */
+static const char	*phase_name(t_view *view)
+{
+	int	phase;
+
+	phase = atomic_load_explicit(&view->hdr->phase, memory_order_acquire);
+	if (phase == SHM_RUNNING)
+		return ("running");
+	if (phase == SHM_STOPPED)
+		return ("stopped");
+	return ("starting");
+}
+
+/**
+ * @name print_summary
+ * @brief One line per sample: how many philosophers do what
+ *
+ * @param view Mapped table
+ * @param s One sample per philosopher
+ * @param now Simulation time of the sample, in ms
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ 1200 ms running eat 2 sleep 2 think 0 fork 1    │
+ * │ meals 9 (min 1) hungriest 3, 400 ms             │
+ * └─────────────────────────────────────────────────┘
+ */
+void	print_summary(t_view *view, t_sample *s, long long now)
+{
+	int				count[5];
+	long long		meals;
+	unsigned int	i;
+	unsigned int	min;
+	unsigned int	oldest;
+
+	memset(count, 0, sizeof(count));
+	meals = 0;
+	min = 0;
+	oldest = 0;
+	i = 0;
+	while (i < view->hdr->count)
+	{
+		count[s[i].state % 5]++;
+		meals += s[i].meals;
+		if (s[i].meals < s[min].meals)
+			min = i;
+		if (s[i].last_meal < s[oldest].last_meal)
+			oldest = i;
+		i++;
+	}
+	printf("%lld ms %s eat %d sleep %d think %d fork %d meals %lld (min %d) "
+		"hungriest %u, %lld ms\n", now, phase_name(view), count[1],
+		count[2], count[3], count[0], meals, s[min].meals, oldest + 1,
+		now - s[oldest].last_meal);
+}
+
+/**
+ * @name print_full
+ * @brief One line per philosopher
+ *
+ * @param view Mapped table
+ * @param s One sample per philosopher
+ * @param now Simulation time of the sample, in ms
+ *
+ * Columns: time, id, state, meals eaten, forks held (L, R, LR or -),
+ * ms since the last meal started.
+ */
+void	print_full(t_view *view, t_sample *s, long long now)
+{
+	static const char	*forks[] = {"-", "L", "R", "LR"};
+	unsigned int		i;
+
+	i = 0;
+	while (i < view->hdr->count)
+	{
+		printf("%lld %u %s %d %s %lld\n", now, i + 1,
+			state_name(view, i + 1, s[i].state), s[i].meals,
+			forks[s[i].forks & 3], now - s[i].last_meal);
+		i++;
+	}
+}
+
+/**
+ * @name print_json
+ * @brief One JSON object per sample, for dashboards and web views
+ *
+ * @param view Mapped table
+ * @param s One sample per philosopher
+ * @param now Simulation time of the sample, in ms
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ {"t":1200,"phase":1,"died":0,"die":800,         │
+ * │  "philos":[[1,3,3,1000],[2,3,0,800],...]}       │
+ * │                                                 │
+ * │ Each philosopher is [state, meals, forks,       │
+ * │ last_meal], as in t_shm_slot                    │
+ * └─────────────────────────────────────────────────┘
+ */
+void	print_json(t_view *view, t_sample *s, long long now)
+{
+	unsigned int	i;
+
+	printf("{\"t\":%lld,\"phase\":%d,\"died\":%d,\"die\":%d,\"philos\":[",
+		now, atomic_load_explicit(&view->hdr->phase, memory_order_acquire),
+		atomic_load_explicit(&view->hdr->died, memory_order_relaxed),
+		view->hdr->time_to_die);
+	i = 0;
+	while (i < view->hdr->count)
+	{
+		if (i > 0)
+			printf(",");
+		printf("[%d,%d,%d,%lld]", s[i].state, s[i].meals, s[i].forks,
+			s[i].last_meal);
+		i++;
+	}
+	printf("]}\n");
+}
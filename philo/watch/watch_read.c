@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   watch_read.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:47:55 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 00:47:55 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "watch.h"
+
+/**
+ * @name state_valid
+ * @brief Checks that a mapped table is one this reader understands
+ *
+ * @param view Freshly mapped table
+ * @return int 1 if the layout matches, 0 otherwise
+ *
+ * The magic is written last by philo, so a table caught while it is
+ * being filled in is simply "not there yet".
+ */
+static int	state_valid(t_view *view)
+{
+	t_shm_header	*hdr;
+
+	hdr = view->hdr;
+	if (view->size < sizeof(t_shm_header)
+		|| memcmp(hdr->magic, SHM_MAGIC, 8) != 0)
+		return (0);
+	atomic_thread_fence(memory_order_acquire);
+	return (hdr->version == SHM_VERSION
+		&& hdr->slot_size == sizeof(t_shm_slot)
+		&& hdr->header_size >= sizeof(t_shm_header)
+		&& view->size >= hdr->header_size
+		+ (size_t)hdr->count * hdr->slot_size);
+}
+
+/**
+ * @name state_attach
+ * @brief Maps the live state table of a running philo
+ *
+ * @param name Name given to philo with --shm=NAME
+ * @param view Output mapping
+ * @return int 0 on success, 1 if there is no such table (yet)
+ */
+int	state_attach(const char *name, t_view *view)
+{
+	struct stat	st;
+	int			fd;
+
+	memset(view, 0, sizeof(t_view));
+	fd = shm_open(name, O_RDONLY, 0);
+	if (fd < 0)
+		return (1);
+	if (fstat(fd, &st) == 0 && st.st_size > 0)
+	{
+		view->size = st.st_size;
+		view->hdr = mmap(NULL, view->size, PROT_READ, MAP_SHARED, fd, 0);
+	}
+	close(fd);
+	if (!view->hdr || view->hdr == MAP_FAILED)
+	{
+		view->hdr = NULL;
+		return (1);
+	}
+	view->slots = (t_shm_slot *)((char *)view->hdr + view->hdr->header_size);
+	if (state_valid(view))
+		return (0);
+	state_detach(view);
+	return (1);
+}
+
+/**
+ * @name state_detach
+ * @brief Unmaps a table
+ *
+ * @param view Mapping from state_attach
+ */
+void	state_detach(t_view *view)
+{
+	if (view->hdr)
+		munmap(view->hdr, view->size);
+	view->hdr = NULL;
+}
+
+/**
+ * @name state_read_slot
+ * @brief Copies one slot without ever blocking its writer
+ *
+ * @param slot Slot in the mapped table
+ * @param out Consistent copy
+ *
+ * Retries while the sequence is odd (an update is in flight) or moved
+ * during the copy. Updates are a handful of stores, so a retry is rare
+ * and short.
+ */
+void	state_read_slot(t_shm_slot *slot, t_sample *out)
+{
+	unsigned int	s1;
+	unsigned int	s2;
+
+	while (1)
+	{
+		s1 = atomic_load_explicit(&slot->seq, memory_order_acquire);
+		out->state = atomic_load_explicit(&slot->state, memory_order_relaxed);
+		out->meals = atomic_load_explicit(&slot->meals, memory_order_relaxed);
+		out->forks = atomic_load_explicit(&slot->forks, memory_order_relaxed);
+		out->last_meal = atomic_load_explicit(&slot->last_meal,
+				memory_order_relaxed);
+		atomic_thread_fence(memory_order_acquire);
+		s2 = atomic_load_explicit(&slot->seq, memory_order_relaxed);
+		if (s1 == s2 && (s1 & 1) == 0)
+			return ;
+	}
+}
+
+/**
+ * @name state_now
+ * @brief Current simulation time as philo counts it
+ *
+ * @param view Mapped table
+ * @return long long ms since the start gate opened, 0 before that
+ */
+long long	state_now(t_view *view)
+{
+	struct timespec	ts;
+	long long		start;
+
+	start = atomic_load_explicit(&view->hdr->start_time,
+			memory_order_relaxed);
+	if (start == 0)
+		return (0);
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000LL + ts.tv_nsec / 1000000 - start);
+}
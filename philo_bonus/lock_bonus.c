@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lock_bonus.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:42:30 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 04:42:30 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+/**
+ * @name futex_wait
+ * @brief Sleeps while a shared word still holds a value
+ *
+ * @param word Word in the MAP_SHARED region
+ * @param value Value the caller saw; any other returns at once
+ * @param timeout_us Longest sleep in µs, or -1 for no limit
+ *
+ * The futex is not FUTEX_PRIVATE: the word sits in a shared mapping,
+ * so the kernel keys it on the page and wakes across processes.
+ * Spurious and early returns are fine, every caller re-checks.
+ */
+void	futex_wait(atomic_int *word, int value, long long timeout_us)
+{
+	struct timespec	ts;
+
+	if (timeout_us < 0)
+	{
+		syscall(SYS_futex, word, FUTEX_WAIT, value, NULL, NULL, 0);
+		return ;
+	}
+	ts.tv_sec = timeout_us / 1000000;
+	ts.tv_nsec = (timeout_us % 1000000) * 1000;
+	syscall(SYS_futex, word, FUTEX_WAIT, value, &ts, NULL, 0);
+}
+
+/**
+ * @name futex_wake
+ * @brief Wakes processes sleeping on a shared word
+ *
+ * @param word Word in the MAP_SHARED region
+ * @param count Most sleepers to wake, INT_MAX for all
+ */
+void	futex_wake(atomic_int *word, int count)
+{
+	syscall(SYS_futex, word, FUTEX_WAKE, count, NULL, NULL, 0);
+}
+
+/**
+ * @name lock_take
+ * @brief Takes a shared lock, sleeping in the kernel while it is held
+ *
+ * @param lock Lock in the MAP_SHARED region
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ free → taken    one compare-exchange, no call   │
+ * │ held → waited   mark it, then FUTEX_WAIT on 2   │
+ * │                                                 │
+ * │ A woken taker takes the lock as waited: it      │
+ * │ cannot know whether others still sleep, so the  │
+ * │ next drop wakes one more, at worst for nothing  │
+ * └─────────────────────────────────────────────────┘
+ */
+void	lock_take(t_lock *lock)
+{
+	int	seen;
+
+	seen = LOCK_FREE;
+	if (atomic_compare_exchange_strong_explicit(&lock->word, &seen,
+			LOCK_TAKEN, memory_order_acquire, memory_order_relaxed))
+		return ;
+	if (seen != LOCK_WAITED)
+		seen = atomic_exchange_explicit(&lock->word, LOCK_WAITED,
+				memory_order_acquire);
+	while (seen != LOCK_FREE)
+	{
+		futex_wait(&lock->word, LOCK_WAITED, -1);
+		seen = atomic_exchange_explicit(&lock->word, LOCK_WAITED,
+				memory_order_acquire);
+	}
+}
+
+/**
+ * @name lock_drop
+ * @brief Releases a shared lock, waking one sleeper if there is one
+ *
+ * @param lock Lock taken by this process
+ *
+ * An uncontended drop is a single atomic: the kernel is only entered
+ * when the word says somebody went to sleep on it.
+ */
+void	lock_drop(t_lock *lock)
+{
+	if (atomic_exchange_explicit(&lock->word, LOCK_FREE,
+			memory_order_release) == LOCK_WAITED)
+		futex_wake(&lock->word, 1);
+}
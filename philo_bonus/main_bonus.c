@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main_bonus.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:59:21 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 04:59:21 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+/**
+ * @name spawn_philosophers
+ * @brief Forks one process per philosopher into a process group of
+ *        their own
+ *
+ * @param b Process state of the parent
+ * @return int SUCCESS if every process started, FAILURE otherwise
+ *
+ * The first child leads the group and every later one joins it; both
+ * sides call setpgid so the group exists whichever runs first. One
+ * kill(-group) then ends every philosopher, and never the parent or
+ * the shell it runs in.
+ */
+int	spawn_philosophers(t_bonus *b)
+{
+	pid_t	pid;
+	int		i;
+
+	i = 0;
+	while (i < b->num_philosophers)
+	{
+		pid = fork();
+		if (pid < 0)
+			return (printf("Error: Cannot fork\n"), FAILURE);
+		if (pid == 0)
+		{
+			setpgid(0, b->group);
+			philosopher_main(b, i + 1);
+		}
+		if (i == 0)
+			b->group = pid;
+		setpgid(pid, b->group);
+		b->pids[i] = pid;
+		i++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @name open_gate
+ * @brief Starts the clock and releases every philosopher at once
+ *
+ * @param b Process state of the parent
+ *
+ * The start time is taken once everyone is forked, so timestamps start
+ * near 0 however long forking N processes took. Each philosopher's
+ * first deadline counts from it.
+ */
+void	open_gate(t_bonus *b)
+{
+	int	i;
+
+	b->table->start_time = get_time();
+	i = 0;
+	while (i < b->num_philosophers)
+	{
+		atomic_store_explicit(&b->seats[i].last_meal, b->table->start_time,
+			memory_order_relaxed);
+		i++;
+	}
+	atomic_store_explicit(&b->table->gate, 1, memory_order_release);
+	futex_wake(&b->table->gate, INT_MAX);
+}
+
+/**
+ * @name main
+ * @brief Entry point of the process-per-philosopher variant
+ *
+ * @param argc Number of command-line arguments
+ * @param argv Array of command-line arguments
+ * @return int 0 on success, 1 on failure
+ *
+ * Example:
+ * ┌────────────────────────────────────────────────────┐
+ * │ Program Execution Flow:                            │
+ * │                                                    │
+ * │ 1. Parse the same arguments as ./philo             │
+ * │ 2. Map the shared table: forks, meal state, stop   │
+ * │ 3. Fork N philosophers, all parked on the gate     │
+ * │ 4. Open the gate and supervise: the parent is the  │
+ * │    monitor, no thread in any process               │
+ * │ 5. On death, SIGKILL the group; then reap, unmap   │
+ * │                                                    │
+ * │ ./philo_bonus number_of_philosophers time_to_die   │
+ * │        time_to_eat time_to_sleep                   │
+ * │        [number_of_times_each_philosopher_must_eat] │
+ * └────────────────────────────────────────────────────┘
+ */
+int	main(int argc, char **argv)
+{
+	t_bonus	b;
+	int		status;
+
+	memset(&b, 0, sizeof(t_bonus));
+	if (parse_args(&b, argc, argv) == FAILURE || table_map(&b) == FAILURE)
+	{
+		table_unmap(&b);
+		return (1);
+	}
+	status = spawn_philosophers(&b);
+	if (status == SUCCESS)
+	{
+		open_gate(&b);
+		supervise(&b);
+	}
+	else if (b.group > 0)
+		kill(-b.group, SIGKILL);
+	reap_children(&b);
+	table_unmap(&b);
+	return (status);
+}
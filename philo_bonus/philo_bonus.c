@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:49:37 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 04:49:37 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+/**
+ * @name philo_alone
+ * @brief The whole life of a lone philosopher: one fork, then starvation
+ *
+ * @param b Process state of philosopher 1
+ *
+ * The second fork never comes; it waits for the parent to announce
+ * the death and stop the run.
+ */
+static void	philo_alone(t_bonus *b)
+{
+	print_state(b, ST_FORK);
+	while (!atomic_load_explicit(&b->table->stop, memory_order_acquire))
+		futex_wait(&b->table->stop, 0, -1);
+}
+
+/**
+ * @name finish_meal
+ * @brief Publishes the end of a meal and puts the forks back
+ *
+ * @param b Process state
+ *
+ * The meal that feeds a philosopher for the must_eat_count-th time
+ * takes it off meals_left, exactly once; the last one to get there
+ * stops the simulation, as update_meal_status does in the thread build.
+ */
+static void	finish_meal(t_bonus *b)
+{
+	t_seat	*seat;
+
+	seat = &b->seats[b->id - 1];
+	atomic_store_explicit(&seat->eating, 0, memory_order_release);
+	if (atomic_fetch_add_explicit(&seat->meals, 1, memory_order_release)
+		+ 1 == b->must_eat_count
+		&& atomic_fetch_sub_explicit(&b->table->meals_left, 1,
+			memory_order_acq_rel) == 1)
+		stop_all_fed(b);
+	lock_drop(b->second);
+	lock_drop(b->first);
+}
+
+/**
+ * @name philo_eat
+ * @brief Takes both forks, eats, and puts them back
+ *
+ * @param b Process state
+ * @return int SUCCESS if the meal completed, FAILURE if the run stopped
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ 1. first fork, stop check, print                │
+ * │ 2. second fork, stop check, print               │
+ * │ 3. last_meal (release), then eating = 1         │
+ * │ 4. eat until phase_end + time_to_eat            │
+ * │ 5. eating = 0, meal count, drop both forks      │
+ * └─────────────────────────────────────────────────┘
+ */
+int	philo_eat(t_bonus *b)
+{
+	t_seat	*seat;
+	int		status;
+
+	seat = &b->seats[b->id - 1];
+	lock_take(b->first);
+	if (atomic_load_explicit(&b->table->stop, memory_order_acquire))
+		return (lock_drop(b->first), FAILURE);
+	print_state(b, ST_FORK);
+	lock_take(b->second);
+	if (atomic_load_explicit(&b->table->stop, memory_order_acquire))
+		return (lock_drop(b->second), lock_drop(b->first), FAILURE);
+	print_state(b, ST_FORK);
+	b->phase_end = get_time_us();
+	atomic_store_explicit(&seat->last_meal, b->phase_end / 1000,
+		memory_order_release);
+	atomic_store_explicit(&seat->eating, 1, memory_order_release);
+	print_state(b, ST_EAT);
+	b->phase_end += b->time_to_eat * 1000LL;
+	status = sleep_until(b, b->phase_end);
+	finish_meal(b);
+	return (status);
+}
+
+/**
+ * @name sleep_and_think
+ * @brief Sleeps, then thinks until the next meal is due
+ *
+ * @param b Process state
+ * @return int SUCCESS to go on eating, FAILURE if the run stopped
+ */
+static int	sleep_and_think(t_bonus *b)
+{
+	print_state(b, ST_SLEEP);
+	b->phase_end += b->time_to_sleep * 1000LL;
+	if (sleep_until(b, b->phase_end) == FAILURE)
+		return (FAILURE);
+	print_state(b, ST_THINK);
+	return (sleep_until(b, think_until(b, b->phase_end)));
+}
+
+/**
+ * @name philosopher_main
+ * @brief Body of a philosopher process, from the start gate to exit
+ *
+ * @param b Process state inherited from the parent
+ * @param id Philosopher this process plays, 1..N
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ 1. Sleep on the gate word until the parent has  │
+ * │    forked everyone and stamped the start time   │
+ * │ 2. Forks: left is id - 1, right is id % N; even │
+ * │    ids take the right one first, and wait 1 ms  │
+ * │    so odd ids get the first round               │
+ * │ 3. eat, sleep, think until stopped or fed; the  │
+ * │    meals left are counted down locally          │
+ * │ 4. _exit: nothing to flush, the parent unmaps   │
+ * └─────────────────────────────────────────────────┘
+ */
+void	philosopher_main(t_bonus *b, int id)
+{
+	int	left;
+
+	b->id = id;
+	while (!atomic_load_explicit(&b->table->gate, memory_order_acquire))
+		futex_wait(&b->table->gate, 0, -1);
+	b->first = &b->forks[id - 1];
+	b->second = &b->forks[id % b->num_philosophers];
+	if (id % 2 == 0)
+	{
+		b->first = b->second;
+		b->second = &b->forks[id - 1];
+		sleep_until(b, get_time_us() + 1000);
+	}
+	atomic_store_explicit(&b->seats[id - 1].last_meal, get_time(),
+		memory_order_release);
+	left = b->must_eat_count;
+	if (b->num_philosophers == 1)
+		philo_alone(b);
+	while (b->num_philosophers > 1 && left != 0 && philo_eat(b) == SUCCESS)
+	{
+		left -= (left > 0);
+		if (sleep_and_think(b) == FAILURE)
+			break ;
+	}
+	_exit(0);
+}
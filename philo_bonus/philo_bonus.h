@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_bonus.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:40:12 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 04:40:12 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PHILO_BONUS_H
+# define PHILO_BONUS_H
+# include <limits.h>
+# include <linux/futex.h>
+# include <sched.h>
+# include <signal.h>
+# include <stdatomic.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <sys/mman.h>
+# include <sys/syscall.h>
+# include <sys/wait.h>
+# include <time.h>
+# include <unistd.h>
+
+typedef enum e_exit_status
+{
+	SUCCESS = 0,
+	FAILURE = 1
+}						t_exit_status;
+
+/* Final stretch of every sleep that is spun instead of blocked, in µs */
+# define SLEEP_SPIN_US 500
+
+/* Shared data is aligned to this so two writers never share a line */
+# define CACHE_LINE 64
+
+/* Reach for the forks at least this long before dying, in µs */
+# define THINK_MARGIN_US 2000
+
+/* Room for a whole "<ms> <id> <status>\n" line */
+# define LINE_SIZE 64
+
+/* States of a lock word: free, taken, taken with sleepers */
+# define LOCK_FREE 0
+# define LOCK_TAKEN 1
+# define LOCK_WAITED 2
+
+typedef enum e_state
+{
+	ST_FORK,
+	ST_EAT,
+	ST_SLEEP,
+	ST_THINK,
+	ST_DIED
+}						t_state;
+
+/*
+** Lock shared by every process: a futex word, never a mutex or a named
+** semaphore, so an uncontended take or drop is one atomic and no call
+** into the kernel.
+*/
+typedef struct s_lock
+{
+	atomic_int			word;
+}	__attribute__((aligned(CACHE_LINE)))	t_lock;
+
+/*
+** Meal state of one philosopher, written only by its process and read
+** by the parent: last_meal is released before eating is raised, so a
+** reader that sees eating == 0 never misses a newer meal.
+*/
+typedef struct s_seat
+{
+	atomic_llong		last_meal;
+	atomic_int			eating;
+	atomic_int			meals;
+}	__attribute__((aligned(CACHE_LINE)))	t_seat;
+
+/*
+** Head of the MAP_SHARED region every process inherits, followed by N
+** seats and N forks. gate opens the start; stop ends the run and is the
+** futex every sleeper waits on, so raising it wakes them all at once.
+*/
+typedef struct s_table
+{
+	atomic_int			gate;
+	atomic_int			stop;
+	atomic_int			meals_left;
+	long long			start_time;
+	t_lock				print;
+}	__attribute__((aligned(CACHE_LINE)))	t_table;
+
+/*
+** Private to each process after fork. id is the philosopher a child
+** plays (1..N) and 0 in the parent; first and second are its forks in
+** the order it takes them.
+*/
+typedef struct s_bonus
+{
+	int					num_philosophers;
+	int					time_to_die;
+	int					time_to_eat;
+	int					time_to_sleep;
+	int					must_eat_count;
+	t_table				*table;
+	size_t				map_size;
+	t_seat				*seats;
+	t_lock				*forks;
+	pid_t				*pids;
+	pid_t				group;
+	int					id;
+	long long			phase_end;
+	t_lock				*first;
+	t_lock				*second;
+	char				line[LINE_SIZE];
+}						t_bonus;
+
+/* Setup */
+int						parse_args(t_bonus *b, int argc, char **argv);
+int						table_map(t_bonus *b);
+void					table_unmap(t_bonus *b);
+int						spawn_philosophers(t_bonus *b);
+void					open_gate(t_bonus *b);
+
+/* Cross-process locks and waits */
+void					futex_wait(atomic_int *word, int value,
+							long long timeout_us);
+void					futex_wake(atomic_int *word, int count);
+void					lock_take(t_lock *lock);
+void					lock_drop(t_lock *lock);
+
+/* Time */
+long long				get_time_us(void);
+long long				get_time(void);
+int						sleep_until(t_bonus *b, long long deadline);
+long long				think_until(t_bonus *b, long long sleep_end);
+
+/* Output and stop */
+void					print_state(t_bonus *b, t_state state);
+int						announce_death(t_bonus *b, int id);
+void					stop_all_fed(t_bonus *b);
+
+/* Philosopher processes */
+void					philosopher_main(t_bonus *b, int id);
+int						philo_eat(t_bonus *b);
+
+/* Parent */
+void					supervise(t_bonus *b);
+void					reap_children(t_bonus *b);
+
+/* Utils */
+int						ft_atoi(const char *str);
+
+#endif
@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   print_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:46:51 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 04:46:51 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+/**
+ * @name put_number
+ * @brief Writes a non-negative number in decimal
+ *
+ * @param dst Destination, room for 20 characters
+ * @param n Number to write
+ * @return int Number of characters written
+ */
+static int	put_number(char *dst, long long n)
+{
+	char	tmp[20];
+	int		len;
+	int		i;
+
+	len = 0;
+	while (len == 0 || n > 0)
+	{
+		tmp[len] = '0' + n % 10;
+		n /= 10;
+		len++;
+	}
+	i = 0;
+	while (i < len)
+	{
+		dst[i] = tmp[len - 1 - i];
+		i++;
+	}
+	return (len);
+}
+
+/**
+ * @name format_line
+ * @brief Formats "<ms> <id> <status>\n" into b->line
+ *
+ * @param b Process state
+ * @param id Philosopher the line is about
+ * @param state State to print
+ * @return int Length of the line
+ */
+static int	format_line(t_bonus *b, int id, t_state state)
+{
+	static const char	*text[] = {" has taken a fork\n", " is eating\n",
+		" is sleeping\n", " is thinking\n", " died\n"};
+	int					len;
+
+	len = put_number(b->line, get_time() - b->table->start_time);
+	b->line[len] = ' ';
+	len += 1 + put_number(b->line + len + 1, id);
+	len += strlen(strcpy(b->line + len, text[state]));
+	return (len);
+}
+
+/**
+ * @name print_state
+ * @brief Prints a status line unless the simulation has stopped
+ *
+ * @param b Process state of a philosopher
+ * @param state State to print
+ *
+ * The stamp is taken and the stop flag read under the shared print
+ * lock, so lines come out in time order and none follows "died".
+ */
+void	print_state(t_bonus *b, t_state state)
+{
+	int	len;
+
+	lock_take(&b->table->print);
+	if (!atomic_load_explicit(&b->table->stop, memory_order_acquire))
+	{
+		len = format_line(b, b->id, state);
+		write(STDOUT_FILENO, b->line, len);
+	}
+	lock_drop(&b->table->print);
+}
+
+/**
+ * @name announce_death
+ * @brief Stops the simulation and prints the death line
+ *
+ * @param b Process state of the parent
+ * @param id Philosopher that starved
+ * @return int 1 if the death was printed, 0 if the run had already
+ *             stopped (every philosopher fed meanwhile)
+ */
+int	announce_death(t_bonus *b, int id)
+{
+	int	len;
+	int	stopped;
+
+	lock_take(&b->table->print);
+	stopped = atomic_exchange_explicit(&b->table->stop, 1,
+			memory_order_acq_rel);
+	if (!stopped)
+	{
+		len = format_line(b, id, ST_DIED);
+		write(STDOUT_FILENO, b->line, len);
+	}
+	lock_drop(&b->table->print);
+	futex_wake(&b->table->stop, INT_MAX);
+	return (!stopped);
+}
+
+/**
+ * @name stop_all_fed
+ * @brief Ends the simulation once every philosopher has eaten enough
+ *
+ * @param b Process state of the last philosopher to be fed
+ *
+ * Taken under the print lock too, so no status line can follow the
+ * stop; the wake-up reaches the parent and every sleeping philosopher.
+ */
+void	stop_all_fed(t_bonus *b)
+{
+	lock_take(&b->table->print);
+	atomic_store_explicit(&b->table->stop, 1, memory_order_release);
+	lock_drop(&b->table->print);
+	futex_wake(&b->table->stop, INT_MAX);
+}
@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   supervise_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:53:18 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 04:53:18 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+/**
+ * @name find_starved
+ * @brief Scans every seat for a missed deadline
+ *
+ * @param b Process state of the parent
+ * @param next Set to the earliest deadline still ahead, in ms
+ * @return int Id of a philosopher that starved, 0 if none did
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ deadline = last_meal (ms) + time_to_die         │
+ * │                                                 │
+ * │ reached, not eating → starved                   │
+ * │ reached, eating     → check again in 1 ms       │
+ * │ ahead               → candidate for next        │
+ * │                                                 │
+ * │ Same rule as check_due_philo in the thread      │
+ * │ build. Deadlines only move later, so sleeping   │
+ * │ until the earliest one seen never misses one    │
+ * └─────────────────────────────────────────────────┘
+ */
+static int	find_starved(t_bonus *b, long long *next)
+{
+	long long	deadline;
+	long long	now;
+	int			eating;
+	int			i;
+
+	now = get_time();
+	*next = LLONG_MAX;
+	i = 0;
+	while (i < b->num_philosophers)
+	{
+		eating = atomic_load_explicit(&b->seats[i].eating,
+				memory_order_acquire);
+		deadline = atomic_load_explicit(&b->seats[i].last_meal,
+				memory_order_acquire) + b->time_to_die;
+		if (eating && deadline <= now)
+			deadline = now + 1;
+		if (deadline <= now)
+			return (i + 1);
+		if (deadline < *next)
+			*next = deadline;
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @name supervise
+ * @brief Parent loop: watches every deadline until a death or all fed
+ *
+ * @param b Process state of the parent
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ scan seats ── none starved ──→ FUTEX_WAIT on    │
+ * │     │                          stop until the   │
+ * │     │                          earliest deadline│
+ * │     └── starved → print "died", SIGKILL the     │
+ * │                   whole process group at once   │
+ * │                                                 │
+ * │ The last philosopher to be fed raises stop and  │
+ * │ wakes the parent, so must-eat is never polled   │
+ * └─────────────────────────────────────────────────┘
+ */
+void	supervise(t_bonus *b)
+{
+	long long	next;
+	long long	wait;
+	int			starved;
+
+	while (!atomic_load_explicit(&b->table->stop, memory_order_acquire))
+	{
+		starved = find_starved(b, &next);
+		if (starved)
+		{
+			if (announce_death(b, starved))
+				kill(-b->group, SIGKILL);
+			return ;
+		}
+		wait = next * 1000 - get_time_us();
+		if (wait > 0)
+			futex_wait(&b->table->stop, 0, wait);
+	}
+}
+
+/**
+ * @name reap_children
+ * @brief Waits for every philosopher process that was started
+ *
+ * @param b Process state of the parent
+ */
+void	reap_children(t_bonus *b)
+{
+	int	i;
+
+	i = 0;
+	while (i < b->num_philosophers && b->pids[i] > 0)
+	{
+		waitpid(b->pids[i], NULL, 0);
+		i++;
+	}
+}
@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   table_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:57:44 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 04:57:44 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+/**
+ * @name table_map
+ * @brief Maps the region every philosopher process shares
+ *
+ * @param b Process state of the parent, before any fork
+ * @return int SUCCESS if the region and the pid list exist, FAILURE
+ *             otherwise
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ MAP_SHARED | MAP_ANONYMOUS, inherited by fork:  │
+ * │                                                 │
+ * │ ┌───────┬─────────────────┬─────────────────┐   │
+ * │ │ table │ seats[0..N-1]   │ forks[0..N-1]   │   │
+ * │ └───────┴─────────────────┴─────────────────┘   │
+ * │ one cache line each, zeroed: every fork free,   │
+ * │ gate shut, stop clear                           │
+ * └─────────────────────────────────────────────────┘
+ */
+int	table_map(t_bonus *b)
+{
+	char	*map;
+
+	b->map_size = sizeof(t_table) + (sizeof(t_seat) + sizeof(t_lock))
+		* (size_t)b->num_philosophers;
+	map = mmap(NULL, b->map_size, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (map == MAP_FAILED)
+		return (printf("Error: Cannot map the shared table\n"), FAILURE);
+	b->table = (t_table *)map;
+	b->seats = (t_seat *)(map + sizeof(t_table));
+	b->forks = (t_lock *)(map + sizeof(t_table)
+			+ sizeof(t_seat) * b->num_philosophers);
+	atomic_init(&b->table->meals_left, b->num_philosophers);
+	b->pids = calloc(b->num_philosophers, sizeof(pid_t));
+	if (!b->pids)
+		return (FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @name table_unmap
+ * @brief Releases the shared region and the pid list
+ *
+ * @param b Process state of the parent
+ */
+void	table_unmap(t_bonus *b)
+{
+	if (b->table)
+		munmap(b->table, b->map_size);
+	free(b->pids);
+	b->table = NULL;
+	b->pids = NULL;
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_bonus.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:44:05 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 04:44:05 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+/**
+ * @name get_time_us
+ * @brief Gets the current monotonic time in microseconds
+ *
+ * @return long long Microseconds since an arbitrary fixed point
+ *
+ * CLOCK_MONOTONIC is the same in every process, so stamps taken by the
+ * parent and by the philosophers compare directly.
+ */
+long long	get_time_us(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((ts.tv_sec * 1000000LL) + (ts.tv_nsec / 1000));
+}
+
+/**
+ * @name get_time
+ * @brief Gets the current monotonic time in milliseconds
+ *
+ * @return long long Milliseconds on the get_time_us clock
+ */
+long long	get_time(void)
+{
+	return (get_time_us() / 1000);
+}
+
+/**
+ * @name sleep_until
+ * @brief Sleeps until an absolute monotonic deadline or simulation stop
+ *
+ * @param b Process state
+ * @param deadline Absolute wake-up time in microseconds (get_time_us)
+ * @return int SUCCESS at the deadline, FAILURE if the simulation stopped
+ *
+ * Example:
+ * ┌─────────────────────────────────────────────────┐
+ * │ now ── FUTEX_WAIT on stop ──┬─ spin ─┐          │
+ * │          deadline - SLEEP_SPIN_US  deadline     │
+ * │                                                 │
+ * │ Raising stop wakes every sleeper at once, the   │
+ * │ cross-process twin of the thread build's        │
+ * │ stop_cond broadcast                             │
+ * └─────────────────────────────────────────────────┘
+ */
+int	sleep_until(t_bonus *b, long long deadline)
+{
+	long long	now;
+
+	now = get_time_us();
+	while (!atomic_load_explicit(&b->table->stop, memory_order_acquire)
+		&& now < deadline - SLEEP_SPIN_US)
+	{
+		futex_wait(&b->table->stop, 0, deadline - SLEEP_SPIN_US - now);
+		now = get_time_us();
+	}
+	if (atomic_load_explicit(&b->table->stop, memory_order_acquire))
+		return (FAILURE);
+	while (get_time_us() < deadline)
+		sched_yield();
+	return (SUCCESS);
+}
+
+/**
+ * @name think_until
+ * @brief Picks when a philosopher should reach for the forks again
+ *
+ * @param b Process state
+ * @param sleep_end End of the sleep just finished, in µs
+ * @return long long Wake-up time in µs
+ *
+ * Same rule as the thread build: at most N/2 philosophers eat at once,
+ * so a meal comes round every N × eat / (N/2) at best and never faster
+ * than eat + sleep; the wake-up is capped THINK_MARGIN_US before the
+ * philosopher's own deadline.
+ */
+long long	think_until(t_bonus *b, long long sleep_end)
+{
+	long long	period;
+	long long	meal_start;
+	long long	wake;
+
+	period = b->time_to_eat * 1000LL;
+	if (b->num_philosophers > 1)
+		period = period * b->num_philosophers / (b->num_philosophers / 2);
+	if (period < (b->time_to_eat + b->time_to_sleep) * 1000LL)
+		period = (b->time_to_eat + b->time_to_sleep) * 1000LL;
+	meal_start = sleep_end - (b->time_to_eat + b->time_to_sleep) * 1000LL;
+	wake = meal_start + period;
+	if (wake > meal_start + b->time_to_die * 1000LL - THINK_MARGIN_US)
+		wake = meal_start + b->time_to_die * 1000LL - THINK_MARGIN_US;
+	return (wake);
+}
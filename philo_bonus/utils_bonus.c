@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   utils_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mkurkar <mkurkar@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 04:55:02 by mkurkar           #+#    #+#             */
+/*   Updated: 2026/10/19 04:55:02 by mkurkar          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_bonus.h"
+
+/**
+ * @name ft_atoi
+ * @brief Converts a string to an integer
+ *
+ * @param str String to convert
+ * @return int The converted integer value
+ *
+ * Example:
+ * ┌───────────────────────────────────────────┐
+ * │ ft_atoi("42") → 42                        │
+ * │ ft_atoi("-42") → -42                      │
+ * │ ft_atoi("  +42") → 42                     │
+ * │ ft_atoi("2147483648") → -1 (overflow)     │
+ * └───────────────────────────────────────────┘
+ */
+int	ft_atoi(const char *str)
+{
+	int	i;
+	int	sign;
+	int	res;
+
+	i = 0;
+	sign = 1;
+	res = 0;
+	while (str[i] == ' ' || str[i] == '\t' || str[i] == '\n' || str[i] == '\v'
+		|| str[i] == '\f' || str[i] == '\r')
+		i++;
+	if (str[i] == '-' || str[i] == '+')
+	{
+		if (str[i] == '-')
+			sign = -1;
+		i++;
+	}
+	while (str[i] >= '0' && str[i] <= '9')
+	{
+		res = res * 10 + str[i] - '0';
+		i++;
+	}
+	return (res * sign);
+}
+
+/**
+ * @name parse_args
+ * @brief Reads the positional arguments, as init_data does in philo/
+ *
+ * @param b Process state to fill
+ * @param argc Argument count from main
+ * @param argv Argument values from main
+ * @return int SUCCESS if the arguments are valid, FAILURE otherwise
+ */
+int	parse_args(t_bonus *b, int argc, char **argv)
+{
+	if (argc < 5 || argc > 6)
+		return (printf("Error: Invalid number of arguments\n"), FAILURE);
+	b->num_philosophers = ft_atoi(argv[1]);
+	b->time_to_die = ft_atoi(argv[2]);
+	b->time_to_eat = ft_atoi(argv[3]);
+	b->time_to_sleep = ft_atoi(argv[4]);
+	b->must_eat_count = -1;
+	if (argc == 6)
+		b->must_eat_count = ft_atoi(argv[5]);
+	if (b->num_philosophers <= 0 || b->time_to_die <= 0
+		|| b->time_to_eat <= 0 || b->time_to_sleep <= 0 || (argc == 6
+			&& b->must_eat_count <= 0))
+		return (printf("Error: Invalid arguments\n"), FAILURE);
+	return (SUCCESS);
+}